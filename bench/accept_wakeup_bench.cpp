@@ -0,0 +1,156 @@
+/**
+ * @brief Executor wakeups per accepted connection with and without EPOLLEXCLUSIVE
+ * @details Several executors, each on its own thread, accept from dup()s of one listening socket, as 
+ *  processes sharing an inherited listener would. Connections arrive one at a time, each on an idle 
+ *  group of executors. Without EPOLLEXCLUSIVE every arrival wakes all executors, with it ideally one. 
+ *  Wakeups are counted as the voluntary context switches of the executor threads, ie: the times they 
+ *  blocked again after having been woken. Executors woken after another one already accepted the 
+ *  connection find nothing and go back to sleep without epoll_wait() ever returning, so the returns 
+ *  of epoll_wait(), counted by interposing it, are shown separately as the wakeups that found work. 
+ *  Usage: accept_wakeup_bench [executors]
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+
+#include "asrt/ip/tcp.hpp"
+#include "bench_util.hpp"
+
+namespace{
+
+    std::atomic<long> g_epoll_returns{0};
+
+}
+
+/* every reactor of the process waits through here */
+extern "C" int epoll_wait(int epfd, ::epoll_event* events, int max_events, int timeout)
+{
+    using EpollWait = int(*)(int, ::epoll_event*, int, int);
+    static EpollWait const real_epoll_wait{reinterpret_cast<EpollWait>(::dlsym(RTLD_NEXT, "epoll_wait"))};
+    int const ready{real_epoll_wait(epfd, events, max_events, timeout)};
+    if(ready > 0) g_epoll_returns.fetch_add(1, std::memory_order_relaxed);
+    return ready;
+}
+
+namespace{
+
+    namespace tcp = asrt::ip::tcp;
+    using namespace std::chrono_literals;
+
+    constexpr int kConnections{200};
+
+    /* voluntary context switches of a thread of this process so far */
+    long VoluntaryContextSwitches(pid_t thread_id)
+    {
+        std::ifstream status{"/proc/self/task/" + std::to_string(thread_id) + "/status"};
+        std::string line;
+        while(std::getline(status, line)){
+            if(line.rfind("voluntary_ctxt_switches:", 0u) == 0u) return std::stol(line.substr(line.find(':') + 1u));
+        }
+        return 0;
+    }
+
+    struct Measurement
+    {
+        double wakeups_per_connection_;
+        double epoll_returns_per_connection_;
+        double cpu_us_per_connection_;
+        int accepted_;
+    };
+
+    Measurement Measure(int executors, tcp::acceptor::AcceptorOptions options)
+    {
+        int const listener{::socket(AF_INET, SOCK_STREAM, 0)};
+        ::sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ::socklen_t length{sizeof(address)};
+        ::bind(listener, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+        ::listen(listener, 1024);
+        ::getsockname(listener, reinterpret_cast<::sockaddr*>(&address), &length);
+
+        std::atomic<int> accepted{0};
+        std::vector<std::unique_ptr<tcp::executor>> group;
+        std::vector<std::unique_ptr<tcp::acceptor>> acceptors;
+        for(int i{0}; i < executors; ++i){
+            group.push_back(std::make_unique<tcp::executor>());
+            acceptors.push_back(std::make_unique<tcp::acceptor>(*group.back(), tcp::v4(), ::dup(listener), options));
+            static_cast<void>(acceptors.back()->AcceptLoopAsync([&accepted](asrt::Result<int>&& result){
+                if(not result.has_value()) return;
+                ::close(result.value());
+                ++accepted;
+            }));
+        }
+        ::close(listener);
+
+        std::vector<std::thread> threads;
+        std::vector<pid_t> thread_ids(group.size());
+        for(std::size_t i{0u}; i < group.size(); ++i){
+            threads.emplace_back([&executor = *group[i], &thread_id = thread_ids[i]](){
+                thread_id = static_cast<pid_t>(::syscall(SYS_gettid));
+                static_cast<void>(executor.Run());
+            });
+        }
+        std::this_thread::sleep_for(50ms); /* let every executor block in epoll_wait() */
+        auto const context_switches{[&thread_ids](){
+            long total{0};
+            for(pid_t const thread_id : thread_ids) total += VoluntaryContextSwitches(thread_id);
+            return total;
+        }};
+
+        timespec cpu_start{};
+        ::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_start);
+        long const epoll_returns_start{g_epoll_returns.load()};
+        long const wakeups_start{context_switches()};
+        std::vector<int> clients;
+        for(int i{0}; i < kConnections; ++i){
+            int const client{::socket(AF_INET, SOCK_STREAM, 0)};
+            ::connect(client, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+            clients.push_back(client);
+            while(accepted.load() <= i) std::this_thread::yield(); /* one arrival at a time */
+            std::this_thread::sleep_for(1ms); /* executors woken in vain go back to sleep */
+        }
+        long const epoll_returns{g_epoll_returns.load() - epoll_returns_start};
+        long const wakeups{context_switches() - wakeups_start};
+        timespec cpu_end{};
+        ::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu_end);
+
+        for(auto& executor : group) executor->Stop();
+        for(std::thread& thread : threads) thread.join();
+        for(int const client : clients) ::close(client);
+
+        double const cpu_us{(static_cast<double>(cpu_end.tv_sec - cpu_start.tv_sec) * 1e9 + 
+            static_cast<double>(cpu_end.tv_nsec - cpu_start.tv_nsec)) / 1e3};
+        return {static_cast<double>(wakeups) / kConnections, static_cast<double>(epoll_returns) / kConnections, 
+            cpu_us / kConnections, accepted.load()};
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int const executors{argc > 1 ? std::atoi(argv[1]) : 4};
+    std::printf("%d executors sharing one listener, %d connections\n", executors, kConnections);
+    std::printf("%-16s %14s %18s %14s\n", "mode", "wakeups/conn", "epoll returns/conn", "cpu us/conn");
+
+    bool ok{true};
+    for(auto const options : {tcp::acceptor::AcceptorOptions::kNone, tcp::acceptor::AcceptorOptions::kExclusiveWakeup}){
+        Measurement const result{Measure(executors, options)};
+        ok = ok && result.accepted_ == kConnections;
+        std::printf("%-16s %14.2f %18.2f %14.1f\n", options == tcp::acceptor::AcceptorOptions::kNone ? "shared" : "EPOLLEXCLUSIVE",
+            result.wakeups_per_connection_, result.epoll_returns_per_connection_, result.cpu_us_per_connection_);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,43 @@
+#ifndef B7E4D2A1_5C38_4F96_8A0B_6D1E9F3C2B74
+#define B7E4D2A1_5C38_4F96_8A0B_6D1E9F3C2B74
+
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+
+namespace asrt::bench{
+
+    /* keep the optimizer from discarding a computed value */
+    template <typename T>
+    inline void DoNotOptimize(T const& value) noexcept
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /* cpu time consumed by the calling thread, user and system */
+    inline double ThreadCpuSeconds() noexcept
+    {
+        ::timespec now{};
+        ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+        return static_cast<double>(now.tv_sec) + static_cast<double>(now.tv_nsec) / 1e9;
+    }
+
+    /* run op repeatedly for at least min_duration, returns the average seconds per run */
+    template <typename Op>
+    double TimePerRun(Op&& op, std::chrono::duration<double> min_duration = std::chrono::milliseconds{200})
+    {
+        using Clock = std::chrono::steady_clock;
+        std::size_t runs{0u};
+        auto const start{Clock::now()};
+        std::chrono::duration<double> elapsed{};
+        do{
+            for(std::size_t i{0u}; i < 16u; ++i) op();
+            runs += 16u;
+            elapsed = Clock::now() - start;
+        }while(elapsed < min_duration);
+        return elapsed.count() / static_cast<double>(runs);
+    }
+
+}
+
+#endif /* B7E4D2A1_5C38_4F96_8A0B_6D1E9F3C2B74 */
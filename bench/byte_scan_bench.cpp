@@ -0,0 +1,57 @@
+/**
+ * @brief Delimiter search throughput of Buffer::FindDelimiter() against std::search, 
+ *  and memmem on 1 KB to 1 MB buffers
+ * @details Each buffer holds random printable bytes with the delimiter at its very end, so every 
+ *  search scans the whole buffer. Build with -DASRT_BUILD_BENCH=ON, add -DASRT_BENCH_NATIVE=ON 
+ *  to measure the AVX2 path on machines supporting it.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "asrt/netbuffer.hpp"
+#include "bench_util.hpp"
+
+namespace{
+
+    double Throughput(std::size_t size, double seconds) { return static_cast<double>(size) / seconds / 1e9; }
+
+}
+
+int main()
+{
+    std::mt19937 rng{42u};
+    std::printf("%-10s %9s %15s %15s %15s\n", "delim len", "size", "FindDelimiter", "std::search", "memmem");
+
+    for(std::string_view const delimiter : {"\n", "\r\n", "\r\n\r\n"}){
+        for(std::size_t const size : {std::size_t{1u} << 10u, std::size_t{1u} << 14u, std::size_t{1u} << 16u, std::size_t{1u} << 20u}){
+            std::vector<char> haystack(size);
+            std::generate(haystack.begin(), haystack.end(), [&rng](){ return static_cast<char>(' ' + rng() % 95u); });
+            std::copy(delimiter.begin(), delimiter.end(), haystack.end() - static_cast<std::ptrdiff_t>(delimiter.size()));
+            std::size_t const expected{size - delimiter.size()};
+
+            Buffer::ConstBufferView const view{haystack.data(), size};
+            double const find_delimiter{asrt::bench::TimePerRun([&](){
+                asrt::bench::DoNotOptimize(Buffer::FindDelimiter(view, delimiter));
+            })};
+            double const search{asrt::bench::TimePerRun([&](){
+                asrt::bench::DoNotOptimize(std::search(haystack.begin(), haystack.end(), delimiter.begin(), delimiter.end()));
+            })};
+            double const memmem{asrt::bench::TimePerRun([&](){
+                asrt::bench::DoNotOptimize(::memmem(haystack.data(), size, delimiter.data(), delimiter.size()));
+            })};
+
+            if(Buffer::FindDelimiter(view, delimiter) != expected){
+                std::fprintf(stderr, "FindDelimiter missed the delimiter\n");
+                return 1;
+            }
+
+            std::printf("%-10zu %9zu %10.2f GB/s %10.2f GB/s %10.2f GB/s\n", delimiter.size(), size,
+                Throughput(size, find_delimiter), Throughput(size, search), Throughput(size, memmem));
+        }
+    }
+    return 0;
+}
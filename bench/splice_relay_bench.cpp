@@ -0,0 +1,187 @@
+/**
+ * @brief Loopback throughput and relay cpu time per GB of SpliceRelay against a user space copy relay
+ * @details A client thread streams 1 GB through the relay to a server thread over loopback TCP, then 
+ *  both half-close. The relay runs on an executor on the main thread, whose cpu time is reported per GB. 
+ *  The copy relay moves the data with ReceiveSomeAsync()/SendAsync() through a user buffer on the same 
+ *  executor, so both relays pay the same reactor and scheduling costs. The endpoints neither fill 
+ *  nor verify the data, so that they stay cheap next to the relay: on few cores they compete with it 
+ *  for the cpu and the throughput measures the whole pipeline, the cpu per GB column isolates the relay.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "asrt/ip/tcp.hpp"
+#include "asrt/socket/splice.hpp"
+#include "bench_util.hpp"
+
+namespace{
+
+    namespace tcp = asrt::ip::tcp;
+
+    constexpr std::size_t kTotalBytes{std::size_t{1u} << 30u};
+    constexpr std::size_t kEndpointChunk{std::size_t{1u} << 16u};
+
+    /* a connected loopback TCP pair, the relay end is non-blocking */
+    std::pair<int, int> ConnectLoopback()
+    {
+        int const listener{::socket(AF_INET, SOCK_STREAM, 0)};
+        ::sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ::socklen_t length{sizeof(address)};
+        ::bind(listener, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+        ::listen(listener, 1);
+        ::getsockname(listener, reinterpret_cast<::sockaddr*>(&address), &length);
+
+        int const endpoint{::socket(AF_INET, SOCK_STREAM, 0)};
+        ::connect(endpoint, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+        int const relay{::accept4(listener, nullptr, nullptr, SOCK_NONBLOCK)};
+        ::close(listener);
+        return {endpoint, relay};
+    }
+
+    /* one direction of the copy relay: receive some into the buffer, send it all, repeat until end of file */
+    class CopyDirection
+    {
+    public:
+        CopyDirection(tcp::socket& from, tcp::socket& to, std::size_t buffer_size)
+            : from_{from}, to_{to}, buffer_(buffer_size) {}
+
+        void Start(std::function<void()> on_done)
+        {
+            this->on_done_ = std::move(on_done);
+            this->ReceiveNext();
+        }
+
+    private:
+        void ReceiveNext()
+        {
+            this->from_.ReceiveSomeAsync(Buffer::make_buffer(this->buffer_), [this](Socket::ReceiveResult&& received){
+                if(not received.has_value() || received.value() == 0u){
+                    static_cast<void>(this->to_.Shutdown(Socket::Types::ShutdownType::kDisableTx));
+                    return this->on_done_();
+                }
+                this->to_.SendAsync(Buffer::ConstBufferView{this->buffer_.data(), received.value()}, 
+                    [this](Socket::SendResult sent){
+                        if(not sent.has_value()) return this->on_done_();
+                        this->ReceiveNext();
+                    });
+            });
+        }
+
+        tcp::socket& from_;
+        tcp::socket& to_;
+        std::vector<std::uint8_t> buffer_;
+        std::function<void()> on_done_;
+    };
+
+    /* stream kTotalBytes from client to server, each side half-closes once done */
+    struct Endpoints
+    {
+        Endpoints(int client, int server)
+            : client_{[client](){
+                std::vector<std::uint8_t> const chunk(kEndpointChunk, std::uint8_t{0x5A});
+                for(std::size_t sent{0u}; sent < kTotalBytes;){
+                    ::ssize_t const n{::send(client, chunk.data(), std::min(chunk.size(), kTotalBytes - sent), 0)};
+                    if(n <= 0) break;
+                    sent += static_cast<std::size_t>(n);
+                }
+                ::shutdown(client, SHUT_WR);
+                std::uint8_t discard;
+                while(::recv(client, &discard, sizeof(discard), 0) > 0){}
+            }},
+              server_{[this, server](){
+                std::vector<std::uint8_t> chunk(kEndpointChunk);
+                ::ssize_t n;
+                while((n = ::recv(server, chunk.data(), chunk.size(), 0)) > 0) this->received_ += static_cast<std::size_t>(n);
+                ::shutdown(server, SHUT_WR);
+            }} {}
+
+        void Join() { this->client_.join(); this->server_.join(); }
+
+        std::size_t received_{0u}; /* declared first, written by server_ */
+        std::thread client_;
+        std::thread server_;
+    };
+
+    struct Measurement
+    {
+        double gb_per_second_;
+        double cpu_seconds_per_gb_;
+        bool ok_;
+    };
+
+    /* relay is invoked with the two relay side sockets and a function to call once both directions ended */
+    template <typename Relay>
+    Measurement Measure(tcp::executor& executor, Relay&& relay)
+    {
+        auto const [client, relay_client]{ConnectLoopback()};
+        auto const [server, relay_server]{ConnectLoopback()};
+        tcp::socket first{executor};
+        tcp::socket second{executor};
+        static_cast<void>(first.AssignAcceptedHandle(tcp::v4(), relay_client));
+        static_cast<void>(second.AssignAcceptedHandle(tcp::v4(), relay_server));
+
+        bool relayed{false};
+        double const cpu_start{asrt::bench::ThreadCpuSeconds()};
+        auto const start{std::chrono::steady_clock::now()};
+        Endpoints endpoints{client, server};
+        relay(first, second, [&](bool ok){
+            relayed = ok;
+            executor.Stop();
+        });
+        executor.Restart();
+        static_cast<void>(executor.Run());
+        double const cpu_seconds{asrt::bench::ThreadCpuSeconds() - cpu_start};
+        endpoints.Join();
+        double const seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+        ::close(client);
+        ::close(server);
+        double const gigabytes{static_cast<double>(kTotalBytes) / 1e9};
+        return {gigabytes / seconds, cpu_seconds / gigabytes, relayed && endpoints.received_ == kTotalBytes};
+    }
+}
+
+int main()
+{
+    tcp::executor executor;
+    bool ok{true};
+    std::printf("%-22s %10s %12s\n", "relay", "GB/s", "cpu s/GB");
+
+    for(std::size_t const buffer_size : {std::size_t{64u} << 10u, std::size_t{1u} << 20u}){
+        Measurement const splice{Measure(executor, [&, buffer_size](tcp::socket& first, tcp::socket& second, auto done){
+            auto relay{std::make_shared<Socket::SpliceRelay<tcp::socket>>(first, second)};
+            bool const started{relay->Open(buffer_size)
+                .and_then([&](){ 
+                    return relay->StartAsync([relay, done, &executor](asrt::Result<void>&& result) mutable {
+                        done(result.has_value());
+                        executor.Post([relay = std::move(relay)](){}); /* released outside its own handler */
+                    }); 
+                }).has_value()};
+            if(not started) done(false);
+        })};
+
+        Measurement const copy{Measure(executor, [buffer_size](tcp::socket& first, tcp::socket& second, auto done){
+            auto forward{std::make_shared<CopyDirection>(first, second, buffer_size)};
+            auto backward{std::make_shared<CopyDirection>(second, first, buffer_size)};
+            auto running{std::make_shared<int>(2)};
+            auto const on_done{[forward, backward, running, done](){ if(--*running == 0) done(true); }};
+            forward->Start(on_done);
+            backward->Start(on_done);
+        })};
+
+        ok = ok && splice.ok_ && copy.ok_;
+        std::printf("splice, %4zu KB pipe    %10.2f %12.3f\n", buffer_size >> 10u, splice.gb_per_second_, splice.cpu_seconds_per_gb_);
+        std::printf("copy,   %4zu KB buffer  %10.2f %12.3f\n", buffer_size >> 10u, copy.gb_per_second_, copy.cpu_seconds_per_gb_);
+    }
+    return ok ? 0 : 1;
+}
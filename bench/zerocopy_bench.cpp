@@ -0,0 +1,144 @@
+/**
+ * @brief Sender cpu time per GB of BasicStreamSocket::SendZeroCopyAsync() against SendAsync() over loopback TCP
+ * @details The executor runs on the main thread, whose cpu time is what the sends cost. A second thread 
+ *  receives and discards the data. Note that the kernel copies zero-copy sends to loopback peers after 
+ *  all (reported as copied), so loopback shows the bookkeeping overhead of MSG_ZEROCOPY rather than 
+ *  its savings, run with a remote receiver for those: zerocopy_bench <ipv4 address> <port>, 
+ *  eg: against `nc -l <port> > /dev/null`.
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "asrt/ip/tcp.hpp"
+#include "bench_util.hpp"
+
+namespace{
+
+    namespace tcp = asrt::ip::tcp;
+
+    constexpr std::size_t kBytesPerRun{std::size_t{1u} << 30u};
+
+    struct Connection
+    {
+        int sender_{-1};
+        int receiver_{-1}; /* -1 when sending to a remote receiver */
+    };
+
+    Connection ConnectLoopback()
+    {
+        int const listener{::socket(AF_INET, SOCK_STREAM, 0)};
+        ::sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ::socklen_t length{sizeof(address)};
+        ::bind(listener, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+        ::listen(listener, 1);
+        ::getsockname(listener, reinterpret_cast<::sockaddr*>(&address), &length);
+
+        Connection connection;
+        connection.sender_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        ::connect(connection.sender_, reinterpret_cast<::sockaddr*>(&address), sizeof(address));
+        connection.receiver_ = ::accept(listener, nullptr, nullptr);
+        ::close(listener);
+        return connection;
+    }
+
+    Connection ConnectRemote(char const* ip, char const* port)
+    {
+        ::sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<std::uint16_t>(std::atoi(port)));
+        ::inet_pton(AF_INET, ip, &address.sin_addr);
+
+        Connection connection;
+        connection.sender_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if(::connect(connection.sender_, reinterpret_cast<::sockaddr*>(&address), sizeof(address)) != 0){
+            std::perror("connect");
+            std::exit(1);
+        }
+        return connection;
+    }
+
+    struct Measurement
+    {
+        double gb_per_second_;
+        double cpu_seconds_per_gb_;
+        bool ok_;
+    };
+
+    /* send kBytesPerRun bytes in sends of message_size bytes, one send outstanding at a time */
+    Measurement Measure(tcp::executor& executor, tcp::socket& socket, std::vector<std::uint8_t> const& message, bool zero_copy)
+    {
+        std::size_t left{kBytesPerRun / message.size()};
+        bool ok{true};
+        std::function<void()> send_next;
+        auto on_sent{[&](Socket::SendResult result){
+            ok = ok && result.has_value() && result.value() == message.size();
+            if(--left == 0u || not ok) executor.Stop();
+            else send_next();
+        }};
+        send_next = [&](){
+            if(zero_copy) socket.SendZeroCopyAsync(Buffer::make_buffer(message), on_sent);
+            else socket.SendAsync(Buffer::make_buffer(message), on_sent);
+        };
+
+        double const cpu_start{asrt::bench::ThreadCpuSeconds()};
+        auto const start{std::chrono::steady_clock::now()};
+        executor.Post(std::function{send_next});
+        executor.Restart();
+        static_cast<void>(executor.Run());
+        double const seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+        double const cpu_seconds{asrt::bench::ThreadCpuSeconds() - cpu_start};
+
+        double const gigabytes{static_cast<double>(kBytesPerRun) / 1e9};
+        return {gigabytes / seconds, cpu_seconds / gigabytes, ok};
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Connection const connection{argc == 3 ? ConnectRemote(argv[1], argv[2]) : ConnectLoopback()};
+    std::thread receiver;
+    if(connection.receiver_ >= 0){
+        receiver = std::thread{[fd = connection.receiver_](){
+            std::vector<std::uint8_t> discard(std::size_t{1u} << 20u);
+            while(::recv(fd, discard.data(), discard.size(), 0) > 0){}
+        }};
+    }
+
+    tcp::executor executor;
+    tcp::socket socket{executor};
+    if(not socket.AssignAcceptedHandle(tcp::v4(), connection.sender_).has_value() || 
+        not socket.SetNonBlocking().has_value() || not socket.EnableZeroCopy().has_value()){
+        std::fprintf(stderr, "Unable to set up a zero-copy socket\n");
+        return 1;
+    }
+
+    std::printf("%-10s %-9s %10s %12s\n", "send size", "mode", "GB/s", "cpu s/GB");
+    bool ok{true};
+    for(std::size_t const size : {std::size_t{64u} << 10u, std::size_t{1u} << 20u, std::size_t{8u} << 20u}){
+        std::vector<std::uint8_t> message(size, std::uint8_t{0x5A});
+        for(bool const zero_copy : {false, true}){
+            Measurement const result{Measure(executor, socket, message, zero_copy)};
+            ok = ok && result.ok_;
+            std::printf("%-10zu %-9s %10.2f %12.3f\n", size, zero_copy ? "zerocopy" : "copy", 
+                result.gb_per_second_, result.cpu_seconds_per_gb_);
+        }
+    }
+
+    Socket::ZeroCopyStatistics const statistics{socket.GetZeroCopyStatistics()};
+    std::printf("zero-copy sends released: %lu, copied by the kernel after all: %lu\n", 
+        static_cast<unsigned long>(statistics.completions_), static_cast<unsigned long>(statistics.copied_));
+
+    static_cast<void>(socket.Close());
+    if(receiver.joinable()) receiver.join();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+#ifndef A6E1D3F8_2B47_4C95_8E0A_7F4C9B25D16E
+#define A6E1D3F8_2B47_4C95_8E0A_7F4C9B25D16E
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <utility>
+
+#include "asrt/netbuffer.hpp"
+
+namespace ClientServer
+{
+    /**
+     * @brief What a broadcast does with a recipient whose outgoing message queue reached its high watermark
+     */
+    enum class BroadcastPolicy : std::uint8_t
+    {
+        kQueue,         /* queue the message anyway, the overflow policy of the recipient's write options applies */
+        kSkip,          /* drop the message for this recipient only */
+        kDisconnect     /* drop the message and disconnect the recipient */
+    };
+
+    struct BroadcastOptions
+    {
+        BroadcastPolicy policy_{BroadcastPolicy::kQueue};
+        /* recipients served by one executor job, the jobs of a broadcast run concurrently on the executor threads */
+        std::size_t recipients_per_job_{256u};
+    };
+
+    struct BroadcastReport
+    {
+        std::size_t recipients_{0u};    /* clients connected when the broadcast was issued */
+        std::size_t queued_{0u};        /* recipients the message was queued to */
+        std::size_t skipped_{0u};       /* recipients not connected anymore, not validated yet or skipped by BroadcastPolicy::kSkip */
+        std::size_t disconnected_{0u};  /* recipients disconnected by BroadcastPolicy::kDisconnect */
+        std::size_t rejected_{0u};      /* recipients whose outgoing message queue rejected the message */
+        /* from the broadcast being issued until the message was queued to the first and the last recipient */
+        std::chrono::nanoseconds first_recipient_latency_{};
+        std::chrono::nanoseconds last_recipient_latency_{};
+    };
+
+    using BroadcastHandler = std::function<void(BroadcastReport const&)>;
+
+    namespace internal
+    {
+        /**
+         * @brief Shared by the jobs of one broadcast, the last job to finish reports
+         *
+         * @tparam Snapshot shared pointer to the recipients
+         */
+        template <typename Snapshot>
+        struct BroadcastState
+        {
+            using Clock = std::chrono::steady_clock;
+
+            BroadcastState(Snapshot recipients, Buffer::PooledBuffer message, BroadcastOptions options,
+                BroadcastHandler handler, std::size_t jobs) noexcept
+                : recipients_{std::move(recipients)}, message_{std::move(message)}, options_{options},
+                  handler_{std::move(handler)}, jobs_left_{jobs} {}
+
+            /**
+             * @brief Record the time the first and last message of a job were queued
+             */
+            void RecordQueued(Clock::time_point first, Clock::time_point last) noexcept
+            {
+                std::int64_t const first_ns{std::chrono::duration_cast<std::chrono::nanoseconds>(first - this->start_).count()};
+                std::int64_t const last_ns{std::chrono::duration_cast<std::chrono::nanoseconds>(last - this->start_).count()};
+                std::int64_t current{this->first_ns_.load(std::memory_order_relaxed)};
+                while(first_ns < current &&
+                    !this->first_ns_.compare_exchange_weak(current, first_ns, std::memory_order_relaxed)) {}
+                current = this->last_ns_.load(std::memory_order_relaxed);
+                while(last_ns > current &&
+                    !this->last_ns_.compare_exchange_weak(current, last_ns, std::memory_order_relaxed)) {}
+            }
+
+            /**
+             * @brief Called once per job, returns true for the last one
+             */
+            bool JobDone() noexcept
+            {
+                return this->jobs_left_.fetch_sub(1u, std::memory_order_acq_rel) == 1u;
+            }
+
+            BroadcastReport Report() const noexcept
+            {
+                std::int64_t const first_ns{this->first_ns_.load(std::memory_order_relaxed)};
+                return BroadcastReport{
+                    .recipients_ = this->recipients_->size(),
+                    .queued_ = this->queued_.load(std::memory_order_relaxed),
+                    .skipped_ = this->skipped_.load(std::memory_order_relaxed),
+                    .disconnected_ = this->disconnected_.load(std::memory_order_relaxed),
+                    .rejected_ = this->rejected_.load(std::memory_order_relaxed),
+                    .first_recipient_latency_ = std::chrono::nanoseconds{
+                        first_ns == std::numeric_limits<std::int64_t>::max() ? 0 : first_ns},
+                    .last_recipient_latency_ = std::chrono::nanoseconds{this->last_ns_.load(std::memory_order_relaxed)}
+                };
+            }
+
+            Snapshot const recipients_;
+            Buffer::PooledBuffer const message_; /* encoded once, queued to every recipient by reference */
+            BroadcastOptions const options_;
+            BroadcastHandler handler_;
+            Clock::time_point const start_{Clock::now()};
+            std::atomic<std::size_t> jobs_left_;
+            std::atomic<std::size_t> queued_{0u};
+            std::atomic<std::size_t> skipped_{0u};
+            std::atomic<std::size_t> disconnected_{0u};
+            std::atomic<std::size_t> rejected_{0u};
+            std::atomic<std::int64_t> first_ns_{std::numeric_limits<std::int64_t>::max()};
+            std::atomic<std::int64_t> last_ns_{0};
+        };
+    }
+
+} //end ns
+
+#endif /* A6E1D3F8_2B47_4C95_8E0A_7F4C9B25D16E */
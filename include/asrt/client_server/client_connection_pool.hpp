@@ -0,0 +1,335 @@
+#ifndef A61C4E8F_2D73_4B95_8E0A_C5F13B7D9264
+#define A61C4E8F_2D73_4B95_8E0A_C5F13B7D9264
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "asrt/util.hpp"
+#include "asrt/error_code.hpp"
+#include "asrt/client_server/connection.hpp"
+#include "asrt/client_server/reconnect_backoff.hpp"
+#include "asrt/client_server/rpc.hpp"
+
+namespace ClientServer
+{
+    namespace internal
+    {
+        static constexpr std::size_t kMaxPoolConnections{64u};
+    }
+
+    struct ClientPoolOptions
+    {
+        std::size_t connections_{1u}; /* kept open to the server, 1 to internal::kMaxPoolConnections */
+        ReconnectOptions reconnect_{};
+    };
+
+    /**
+     * @brief Connections of a client to one server, kept open in the background
+     * @details Connect() starts all connections at once without waiting for them. A lost connection is replaced
+     *  right away, the replacement retries with jittered exponential backoff while the server is unreachable or
+     *  drops connections before validating them. Meanwhile Select() skips the member, so messages move to the
+     *  connections left and a server restart does not hold up the senders. Each member completes the rpc calls
+     *  issued on its connection, they fail with the connection error once it is lost.
+     *
+     * @tparam Client receives the messages and connection errors of all connections, eg: ClientInterface
+     * @note Select() and the queries are thread safe, Connect() and Close() must not run concurrently.
+     */
+    template <typename Executor, typename Protocol, typename Message, typename Client>
+    class ClientConnectionPool
+    {
+    public:
+        class Member;
+
+        using Connection    = ClientServer::Connection<Executor, Protocol, Message, Member>;
+        using ConnectionPtr = std::shared_ptr<Connection>;
+        using Endpoint      = typename Protocol::Endpoint;
+        using Duration      = typename Connection::Duration;
+        using Calls         = RpcCallTable<Executor>;
+
+        /**
+         * @brief One connection of the pool and the rpc calls issued on it, owner of the connection
+         */
+        class Member
+        {
+        public:
+            static constexpr auto Identity() noexcept {return Identity::kClient;}
+
+            explicit Member(ClientConnectionPool& pool) noexcept
+                : pool_{pool}, calls_{pool.executor_}, backoff_{pool.options_.reconnect_} {}
+
+            Member(Member const&) = delete;
+            Member(Member&&) = delete;
+            Member &operator=(Member const &other) = delete;
+            Member &operator=(Member &&other) = delete;
+            ~Member() noexcept = default;
+
+            /**
+             * @brief The current connection, null while closed or being replaced
+             */
+            auto GetConnection() const noexcept -> ConnectionPtr
+            {
+                std::scoped_lock const lock{this->mtx_};
+                return this->connection_;
+            }
+
+            Calls& GetCalls() noexcept { return this->calls_; }
+
+            Calls const& GetCalls() const noexcept { return this->calls_; }
+
+            void Open(Endpoint const& server) noexcept
+            {
+                ConnectionPtr const connection{Connection::Create(this->pool_.executor_, *this)};
+                {
+                    std::scoped_lock const lock{this->mtx_};
+                    ++this->epoch_;
+                    this->open_ = true;
+                    this->validated_ = false;
+                    this->server_ = server;
+                    this->backoff_.Reset();
+                    this->connection_ = connection;
+                }
+                connection->ConnectToServer(server, this->pool_.options_.reconnect_);
+            }
+
+            void Close() noexcept
+            {
+                ConnectionPtr connection;
+                {
+                    std::scoped_lock const lock{this->mtx_};
+                    ++this->epoch_;
+                    this->open_ = false;
+                    connection.swap(this->connection_);
+                }
+                if(connection)
+                    connection->Close();
+                this->calls_.FailAll(ErrorCode_Ns::ErrorCode::operation_aborted);
+            }
+
+            /* Called by the connection */
+
+            auto RetrieveInbox() noexcept
+            {
+                return this->pool_.client_.RetrieveInbox();
+            }
+
+            void OnMessage(std::span<std::uint8_t const> message) noexcept
+            {
+                this->pool_.client_.OnMessage(message);
+            }
+
+            void OnServerWritable() noexcept
+            {
+                this->pool_.client_.OnServerWritable();
+            }
+
+            void OnServerValidated(ConnectionPtr const& connection) noexcept
+            {
+                std::scoped_lock const lock{this->mtx_};
+                if(connection == this->connection_){
+                    this->validated_ = true;
+                    this->backoff_.Reset();
+                }
+            }
+
+            void OnRpcResponse(Frame&& frame) noexcept
+            {
+                auto reply{RpcReply::FromFrame(std::move(frame))};
+                if(!reply.has_value()) [[unlikely]] {
+                    ASRT_LOG_WARN("Server sent a malformed rpc response, dropping it");
+                    return;
+                }
+                this->calls_.Complete(std::move(reply.value()));
+            }
+
+            void OnConnectionError(ConnectionPtr const& connection, ErrorCode_Ns::ErrorCode ec) noexcept
+            {
+                std::size_t epoch;
+                Duration delay{Duration::zero()};
+                ConnectionPtr lost;
+                {
+                    std::scoped_lock const lock{this->mtx_};
+                    if(!this->open_ || !connection || connection != this->connection_)
+                        return; /* closed, or a later error of a connection already replaced */
+                    epoch = this->epoch_;
+                    /* a connection lost once validated is replaced at once, one failing earlier backs off */
+                    if(!this->validated_)
+                        delay = this->backoff_.Next();
+                    this->validated_ = false;
+                    lost.swap(this->connection_); /* skipped by Select() until replaced */
+                }
+                /* the error is reported from inside the lost connection's handlers, release it once they return */
+                this->pool_.executor_.Post([lost = std::move(lost)]() noexcept {});
+
+                this->calls_.FailAll(ec); /* their replies are lost with the connection */
+                this->pool_.client_.OnConnectionError(ec);
+
+                ConnectionPtr const replacement{Connection::Create(this->pool_.executor_, *this)};
+                Endpoint server;
+                {
+                    std::scoped_lock const lock{this->mtx_};
+                    if(epoch != this->epoch_) [[unlikely]]
+                        return; /* closed or reopened meanwhile */
+                    this->connection_ = replacement;
+                    server = this->server_;
+                }
+                ASRT_LOG_DEBUG("Replacing connection lost with {}, reconnecting in {}ms", ec,
+                    std::chrono::duration_cast<std::chrono::milliseconds>(delay).count());
+                replacement->ConnectToServer(server, this->pool_.options_.reconnect_, delay);
+            }
+
+        private:
+            using MutexType = typename Executor::MutexType;
+
+            ClientConnectionPool& pool_;
+            Calls calls_; /* outlives connection_, which completes them */
+            mutable MutexType mtx_;
+            ConnectionPtr connection_{};
+            Endpoint server_{};
+            internal::ReconnectBackoff backoff_;
+            std::size_t epoch_{0u}; /* advanced by Open() and Close() */
+            bool open_{false};
+            bool validated_{false};
+        };
+
+        /**
+         * @brief A member and its connection, see Select()
+         */
+        struct Selection
+        {
+            Member* member_{nullptr};
+            ConnectionPtr connection_{};
+
+            explicit operator bool() const noexcept { return this->member_ != nullptr; }
+        };
+
+        ClientConnectionPool(Executor& executor, Client& client, ClientPoolOptions options = {}) noexcept
+            : executor_{executor}, client_{client}, options_{options}
+        {
+            std::size_t count{options.connections_};
+            if(count == 0u || count > internal::kMaxPoolConnections) [[unlikely]] {
+                count = count == 0u ? 1u : internal::kMaxPoolConnections;
+                ASRT_LOG_WARN("Client connection pool size {} out of range, using {}", options.connections_, count);
+            }
+            this->members_.reserve(count);
+            for(std::size_t i{0u}; i < count; ++i)
+                this->members_.emplace_back(std::make_unique<Member>(*this));
+        }
+
+        ClientConnectionPool(ClientConnectionPool const&) = delete;
+        ClientConnectionPool(ClientConnectionPool&&) = delete;
+        ClientConnectionPool &operator=(ClientConnectionPool const &other) = delete;
+        ClientConnectionPool &operator=(ClientConnectionPool &&other) = delete;
+
+        ~ClientConnectionPool() noexcept
+        {
+            this->Close();
+        }
+
+        /**
+         * @brief Start connecting all connections to server in the background
+         *
+         * @param server
+         */
+        void Connect(Endpoint const& server) noexcept
+        {
+            for(auto const& member : this->members_)
+                member->Open(server);
+        }
+
+        /**
+         * @brief Close all connections and stop reconnecting, the calls in flight fail with operation_aborted
+         */
+        void Close() noexcept
+        {
+            for(auto const& member : this->members_)
+                member->Close();
+        }
+
+        /**
+         * @brief Pick the connected member with the fewest unsent bytes, then with the fewest calls in flight
+         * @details The scan starts at a member rotating with every selection and ends at the first idle member,
+         *  so an idle pool spreads messages over its connections after a single look.
+         *
+         * @return Selection empty if no connection is connected
+         */
+        auto Select() noexcept -> Selection
+        {
+            std::size_t const count{this->members_.size()};
+            std::size_t const start{count == 1u ? 0u : this->next_.fetch_add(1u, std::memory_order::relaxed)};
+
+            Selection selection{};
+            std::size_t least_bytes{0u};
+            std::size_t least_calls{0u};
+            for(std::size_t i{0u}; i < count; ++i){
+                Member& member{*this->members_[(start + i) % count]};
+                ConnectionPtr connection{member.GetConnection()};
+                if(!connection || !connection->IsConnected())
+                    continue;
+
+                std::size_t const bytes{connection->UnsentBytes()};
+                std::size_t const calls{member.GetCalls().InFlight()};
+                if(!selection || bytes < least_bytes || (bytes == least_bytes && calls < least_calls)){
+                    selection = Selection{&member, std::move(connection)};
+                    least_bytes = bytes;
+                    least_calls = calls;
+                    if(bytes == 0u && calls == 0u)
+                        break;
+                }
+            }
+            return selection;
+        }
+
+        /**
+         * @brief The first member and its connection whether connected or not, eg: to queue a message until connected
+         */
+        auto Front() const noexcept -> Selection
+        {
+            Member& member{*this->members_.front()};
+            ConnectionPtr connection{member.GetConnection()};
+            return connection ? Selection{&member, std::move(connection)} : Selection{};
+        }
+
+        bool IsConnected() const noexcept
+        {
+            return this->ConnectedCount() != 0u;
+        }
+
+        std::size_t ConnectedCount() const noexcept
+        {
+            std::size_t connected{0u};
+            for(auto const& member : this->members_){
+                ConnectionPtr const connection{member->GetConnection()};
+                connected += (connection && connection->IsConnected()) ? 1u : 0u;
+            }
+            return connected;
+        }
+
+        std::size_t CallsInFlight() const noexcept
+        {
+            std::size_t calls{0u};
+            for(auto const& member : this->members_)
+                calls += member->GetCalls().InFlight();
+            return calls;
+        }
+
+        std::size_t Size() const noexcept { return this->members_.size(); }
+
+        Executor& GetExecutor() const noexcept { return this->executor_; }
+
+    private:
+        Executor& executor_;
+        Client& client_;
+        ClientPoolOptions const options_;
+        std::vector<std::unique_ptr<Member>> members_{};
+        std::atomic<std::size_t> next_{0u}; /* where the next selection starts */
+    };
+
+} //end ns
+
+#endif /* A61C4E8F_2D73_4B95_8E0A_C5F13B7D9264 */
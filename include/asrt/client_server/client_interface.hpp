@@ -4,8 +4,10 @@
 #include "asrt/util.hpp"
 #include "asrt/error_code.hpp"
 #include "asrt/client_server/common_types.hpp"
-#include "asrt/client_server/message_queue.hpp"
+#include "asrt/client_server/mpsc_inbox.hpp"
 #include "asrt/client_server/connection.hpp"
+#include "asrt/client_server/client_connection_pool.hpp"
+#include "asrt/client_server/rpc.hpp"
 
 namespace ClientServer{
 
@@ -18,37 +20,58 @@ class ClientInterface
 public:
 
     using Endpoint = typename Protocol::Endpoint;
-    using ConnectionToServer = Connection<Executor, Protocol, Message, ClientInterface>;
+    using Pool = ClientConnectionPool<Executor, Protocol, Message, ClientInterface>;
+    using ConnectionToServer = typename Pool::Connection;
     using ConstMessageView = typename ConnectionToServer::ConstMessageView;
     using Server = std::shared_ptr<ConnectionToServer>;
     using Inbox = typename ConnectionToServer::Inbox;
+    using CallOptions = RpcCallOptions<Executor>;
 
     static constexpr auto Identity() {return Identity::kClient;}
 
-    explicit ClientInterface(Executor& executor, ProcessingMode mode = ProcessingMode::kEvent) noexcept;
+    /**
+     * @brief Construct a new client
+     * 
+     * @param executor 
+     * @param mode 
+     * @param pool_options number of connections kept open to the server and how they reconnect
+     */
+    explicit ClientInterface(Executor& executor, ProcessingMode mode = ProcessingMode::kEvent, 
+        ClientPoolOptions pool_options = {}) noexcept;
     ClientInterface(ClientInterface const&) = delete;
     ClientInterface(ClientInterface&&) = delete;
     ClientInterface &operator=(ClientInterface const &other) = delete;
     ClientInterface &operator=(ClientInterface &&other) = delete;
     virtual ~ClientInterface() noexcept;
 
+    /**
+     * @brief Whether any connection to the server is connected
+     */
     bool IsConnected() noexcept;
 
     /**
-     * @brief Starts a connection to the remote server.
+     * @brief Whether the outgoing message queue of the least loaded connection has room, see OnServerWritable(). 
+     *  Also true while not connected, when messages are rejected right away instead.
+     */
+    bool IsWritable() noexcept;
+
+    /**
+     * @brief Starts the connections to the remote server in the background.
+     * @details Lost connections are replaced until Disconnect(), messages and calls meanwhile go through 
+     *  the connections left. Each message goes through the connection with the least data unsent.
      * 
      * @param server 
      */
     void Connect(const Endpoint& server) noexcept;
 
     /**
-     * @brief Kills the current connection
+     * @brief Kills the current connections
      * 
      */
     void Disconnect() noexcept;
 
     /**
-     * @brief Resets current connection and initiates a new connection to remote server.
+     * @brief Resets current connections and initiates new connections to remote server.
      * 
      * @param server 
      */
@@ -56,21 +79,66 @@ public:
     
     void Send(const Message& message) noexcept;
 
+    /**
+     * @brief Send a message of the given type made of body, header and body leave as a single write
+     * 
+     * @param type 
+     * @param body copied, may be released once the function returns
+     */
+    void Send(std::uint8_t type, ConstMessageView body) noexcept;
+
     void SendSync(ConstMessageView message) noexcept;
 
+    /**
+     * @brief Call a method of the server without waiting for its reply
+     * @details Calls are pipelined: requests leave as soon as they are issued, coalesced with the other 
+     *  messages of the same executor turn, without waiting for the replies to earlier calls, which may 
+     *  arrive in any order. Each reply is matched to its call by correlation id. A call completes exactly 
+     *  once, with the reply, with timed_out once its deadline passed, or with the error the connection 
+     *  failed with. Replies are handled right away in polling mode as well, they do not go through the inbox.
+     * 
+     * @param method 
+     * @param payload copied, may be released once the function returns
+     * @param handler void(Result<RpcReply>), not invoked if the call is rejected
+     * @param options deadline and the strand to run handler on
+     * @return Result<void> not_connected, capacity_exceeded if too many calls are in flight, 
+     *  or the error the request could not be queued with
+     */
+    auto Call(std::uint16_t method, ConstMessageView payload, RpcHandler handler, 
+        CallOptions options = {}) noexcept -> Result<void>;
+
+    /**
+     * @brief Number of calls awaiting their reply
+     */
+    std::size_t CallsInFlight() const noexcept;
+
+    /**
+     * @brief Number of connections to the server currently connected
+     */
+    std::size_t ConnectedCount() const noexcept;
+
     auto RetrieveInbox() noexcept -> Inbox*;
 
     void OnConnectionError(ErrorCode_Ns::ErrorCode ec) noexcept;
 
     virtual void OnMessage(ConstMessageView message) noexcept = 0;
 
+    /**
+     * @brief Customization point for client implementation, called for each connection the server closed
+     */
     virtual void OnServerDisconnect() noexcept {}
 
+    /**
+     * @brief Customization point for client implementation to resume sending once the 
+     *  outgoing message queue drained to its low watermark after reaching its high watermark
+     */
+    virtual void OnServerWritable() noexcept {}
+
 private:
     template <typename T> using Optional = Util::Optional_NS::Optional<T>;
 
     Optional<Inbox> inbox_;
-    Server connection_;
+    Pool pool_;
 };
 
 }
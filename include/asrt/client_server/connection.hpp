@@ -2,6 +2,9 @@
 #define B4265F04_04CF_40E7_94C3_CC5FA4199BD5
 
 #include <cstdint>
+#include <cstring>
+#include <array>
+#include <vector>
 #include <memory>
 #include <atomic>
 #include <random>
@@ -15,16 +18,21 @@
 #include "asrt/common_types.hpp"
 #include "asrt/util.hpp"
 #include "asrt/concepts.hpp"
-#include "asrt/client_server/message_queue.hpp"
+#include "asrt/client_server/framing.hpp"
+#include "asrt/client_server/mpsc_inbox.hpp"
+#include "asrt/client_server/rpc.hpp"
+#include "asrt/client_server/reconnect_backoff.hpp"
 #include "asrt/netbuffer.hpp"
 #include "asrt/error_code.hpp"
 #include "asrt/socket/address_types.hpp"
+#include "asrt/socket/write_coalescer.hpp"
 #include "asrt/executor/strand.hpp"
 
 namespace ClientServer
 {   
     using namespace Util::Expected_NS;
     using namespace std::chrono_literals;
+    using asrt::Result;
     using namespace AddressTypes;
 
     template <typename Callback, typename Message>
@@ -104,6 +112,7 @@ namespace ClientServer
     public:
 
         using ExecutorType      = Executor;
+        using OwnerType         = ConnectionOwner;
         using ProtocolType      = Protocol;
         using MessageType       = Message;
         using ConstMessageView  = std::span<std::uint8_t const>;
@@ -117,13 +126,17 @@ namespace ClientServer
         using ConnectionType    = Connection;
         using MessageSource     = std::shared_ptr<Connection>;
         using Strand            = ExecutorNS::Strand<Executor>;
+        using Writer            = ::Socket::WriteCoalescer<Socket>;
+        using WriteOptions      = ::Socket::WriteCoalescerOptions;
+
+        using Reader            = FrameReader<Executor>;
 
         struct IncomingMessage{
-            MessageSource source_{this->shared_from_this()};
-            Message msg_;
+            MessageSource source_{};
+            Frame msg_{}; /* viewed in the buffer it was received into */
         };
 
-        using Inbox = ThreadSafeQueue<IncomingMessage, typename Executor::MutexType>;
+        using Inbox = MpscInbox<IncomingMessage, typename Executor::MutexType>;
 
     public:
         
@@ -133,11 +146,14 @@ namespace ClientServer
          * @param executor used to execute message handlers
          * @param owner owner of this connection
          * @param conn_id an optional id assigned to this connection
+         * @param write_options bounds and overflow policy of the outgoing message queue
          */
-        Connection(Executor& executor, ConnectionOwner& owner, ConnectionIdType conn_id = 0) noexcept 
+        Connection(Executor& executor, ConnectionOwner& owner, ConnectionIdType conn_id = 0, 
+                   WriteOptions write_options = {}) noexcept 
             : executor_{executor}, 
               strand_{executor}, 
               socket_{executor},
+              writer_{socket_, executor, write_options},
               owner_{owner},
               inbox_{owner.RetrieveInbox()},
               conn_id_{conn_id} 
@@ -151,6 +167,20 @@ namespace ClientServer
             }
             
             this->PrepareAuthInfo();
+
+            this->writer_.SetErrorHandler([this](ErrorCode_Ns::ErrorCode ec){
+                ASRT_LOG_ERROR("Failed to send message(s): {}", ec);
+                this->HandleCommunicationError(ec);
+            });
+
+            this->writer_.SetWritableHandler([this](){
+                if constexpr (IsServer()){
+                    auto self{this->shared_from_this()};
+                    this->owner_.OnClientWritable(self);
+                }else if constexpr (IsClient()){
+                    this->owner_.OnServerWritable();
+                }
+            });
         }
 
         Connection(Connection const&) = delete;
@@ -169,13 +199,45 @@ namespace ClientServer
         static std::shared_ptr<Connection> Create(
             Executor& executor, 
             ConnectionOwner& owner, 
-            ConnectionIdType conn_id = 0) noexcept
+            ConnectionIdType conn_id = 0,
+            WriteOptions write_options = {}) noexcept
         {
-            return std::make_shared<Connection>(executor, owner, conn_id);
+            return std::make_shared<Connection>(executor, owner, conn_id, write_options);
         }
 
         ConnectionIdType GetId() const noexcept {return conn_id_;}
 
+        /**
+         * @brief Close the connection and drop its per-connection state so that the object can be reused
+         * @details The socket keeps its reactor slot if told to retain it. Only to be called once 
+         *  no references other than the caller's are left, eg: by the deleter of a pooled connection.
+         */
+        void Recycle() noexcept
+        {
+            ASRT_LOG_TRACE("Connection {} recycled", GetId());
+            static_cast<void>(this->socket_.Close());
+            this->outbox_.clear();
+            this->backlog_.Clear();
+            this->backlog_pending_.store(true, std::memory_order::relaxed);
+            this->reader_.Reset();
+            this->is_connection_validated_cached_ = false;
+            this->is_connection_validated_.store(false, std::memory_order::relaxed);
+        }
+
+        /**
+         * @brief Prepare a recycled connection for its next peer, as if it was newly constructed
+         * 
+         * @param conn_id 
+         * @param write_options 
+         */
+        void Reuse(ConnectionIdType conn_id, WriteOptions write_options = {}) noexcept
+        {
+            ASRT_LOG_TRACE("{} connection reused with id {}", ConnectionIdentity(), conn_id);
+            this->conn_id_ = conn_id;
+            this->writer_.Reset(write_options);
+            this->PrepareAuthInfo();
+        }
+
         Executor& GetExecutor() const noexcept {return executor_;}
         
         void SendSync(ConstMessageView message_view) noexcept
@@ -184,8 +246,7 @@ namespace ClientServer
 
             if(not this->is_connection_validated_) [[unlikely]] {
                 ASRT_LOG_TRACE("Saved SendSync message while connection is being validated");
-                //todo this is not thread safe what if there's an ongoing SendAsync operation?
-                this->outbox_.emplace_back(message_view);
+                static_cast<void>(this->Write(message_view));
                 return;
             }
 
@@ -195,7 +256,7 @@ namespace ClientServer
                     if(ErrorCode_Ns::IsUnconnected(ec)) [[likely]] {
                         ASRT_LOG_INFO(
                             "Failed to send message: server unreachable. Retrying when connected");
-                        this->outbox_.emplace_back(message_view);
+                        static_cast<void>(this->Write(message_view));
                         return;
                     }
                 }
@@ -206,14 +267,149 @@ namespace ClientServer
             });
         }
 
+        /**
+         * @brief Queue a message for sending without waiting for it to be sent
+         * @details Messages written within the same executor turn leave with a single send. 
+         *  Once the queued data exceeds the high watermark of the write options, the overflow policy 
+         *  either drops the oldest queued messages, blocks the caller or disconnects.
+         * 
+         * @param message_view copied, may be released once the function returns
+         * @return Result<void> see WriteCoalescer::Write()
+         */
+        auto Write(ConstMessageView message_view) noexcept -> Result<void>
+        {
+            ASRT_LOG_TRACE("Connection Write: {}", spdlog::to_hex(message_view));
+
+            if(this->backlog_pending_.load(std::memory_order::acquire)) [[unlikely]] {
+                /* serialized with the backlog flush, which decides where the message goes */
+                this->strand_.Dispatch(
+                    [self = this->shared_from_this(), 
+                     message = std::vector<std::uint8_t>(message_view.begin(), message_view.end())](){
+                        static_cast<void>(self->DoWriteOrBacklog(message));
+                    });
+                return Result<void>{};
+            }
+
+            return this->writer_.Write(message_view)
+            .map_error([this](ErrorCode_Ns::ErrorCode ec){
+                ASRT_LOG_DEBUG("Connection {} dropped message: {}", GetId(), ec);
+                return ec;
+            });
+        }
+
+        /**
+         * @brief Queue a message encoded into a pooled buffer for sending without copying it, 
+         *  eg: the same message written to many connections
+         * 
+         * @param message kept until sent, must not be modified meanwhile
+         * @return Result<void> see WriteCoalescer::Write()
+         */
+        auto Write(Buffer::PooledBuffer message) noexcept -> Result<void>
+        {
+            if(this->backlog_pending_.load(std::memory_order::acquire)) [[unlikely]] {
+                this->strand_.Dispatch(
+                    [self = this->shared_from_this(), message = std::move(message)](){
+                        static_cast<void>(self->DoWriteOrBacklog({message.data(), message.size()}));
+                    });
+                return Result<void>{};
+            }
+
+            return this->writer_.Write(std::move(message))
+            .map_error([this](ErrorCode_Ns::ErrorCode ec){
+                ASRT_LOG_DEBUG("Connection {} dropped message: {}", GetId(), ec);
+                return ec;
+            });
+        }
+
+        /**
+         * @brief Queue a message made of a header encoding type and the length of body, followed by body, 
+         *  as a single write without building the message first
+         * 
+         * @param type 
+         * @param body copied, may be released once the function returns
+         * @return Result<void> see WriteCoalescer::Write()
+         */
+        auto WriteFrame(std::uint8_t type, ConstMessageView body) noexcept -> Result<void>
+        {
+            return this->WriteFrame(type, ConstMessageView{}, body);
+        }
+
+        /**
+         * @brief Like WriteFrame(type, body), for a body made of prefix followed by body, eg: a protocol header
+         *  and its payload
+         * 
+         * @param type 
+         * @param prefix copied, may be released once the function returns
+         * @param body copied, may be released once the function returns
+         * @return Result<void> see WriteCoalescer::Write()
+         */
+        auto WriteFrame(std::uint8_t type, ConstMessageView prefix, ConstMessageView body) noexcept -> Result<void>
+        {
+            auto const header{FrameHeader{type, static_cast<std::uint32_t>(prefix.size() + body.size())}.Encode()};
+            if(this->backlog_pending_.load(std::memory_order::acquire)) [[unlikely]]
+                return this->WriteFrameToBacklog(header, prefix, body);
+
+            std::array<Buffer::ConstBufferView, 3u> const pieces{
+                Buffer::ConstBufferView{header.data(), header.size()}, 
+                Buffer::ConstBufferView{prefix.data(), prefix.size()}, 
+                Buffer::ConstBufferView{body.data(), body.size()}};
+            return this->writer_.Write(std::span<Buffer::ConstBufferView const>{pieces})
+            .map_error([this](ErrorCode_Ns::ErrorCode ec){
+                ASRT_LOG_DEBUG("Connection {} dropped message: {}", GetId(), ec);
+                return ec;
+            });
+        }
+
+        /**
+         * @brief Queue a message made of a header encoding type and the length of body, followed by body, 
+         *  as a single write. The header and body leave with one vectored send, body is not copied.
+         * 
+         * @param type 
+         * @param body kept until sent, must not be modified meanwhile, eg: the body of a received Frame
+         * @return Result<void> see WriteCoalescer::Write()
+         */
+        auto WriteFrame(std::uint8_t type, Buffer::PooledBuffer body) noexcept -> Result<void>
+        {
+            auto const header{FrameHeader{type, static_cast<std::uint32_t>(body.size())}.Encode()};
+            if(this->backlog_pending_.load(std::memory_order::acquire)) [[unlikely]]
+                return this->WriteFrameToBacklog(header, {}, {body.data(), body.size()});
+
+            return this->writer_.Write(Buffer::ConstBufferView{header.data(), header.size()}, std::move(body))
+            .map_error([this](ErrorCode_Ns::ErrorCode ec){
+                ASRT_LOG_DEBUG("Connection {} dropped message: {}", GetId(), ec);
+                return ec;
+            });
+        }
+
         void Send(const Message& message) noexcept
         {
-            //todo needs to implement TrySend so that 
-            //todo we can accept message view. This way the message doesn't have to be uneccessarily copied
-            this->strand_.Dispatch(
-                [self = this->shared_from_this(), message](){
-                    self->DoSendMessage2(message);
-                });
+            Buffer::ConstBufferView const data{message.DataView()};
+            static_cast<void>(this->Write({static_cast<std::uint8_t const*>(data.data()), data.size()}));
+        }
+
+        /**
+         * @brief Whether the outgoing message queue is below its high watermark, 
+         *  or drained to its low watermark since it last reached it
+         */
+        bool IsWritable() const noexcept
+        {
+            return this->writer_.IsWritable();
+        }
+
+        /**
+         * @brief Bytes written but not yet fully sent, eg: to pick the least loaded of several connections
+         */
+        std::size_t UnsentBytes() const noexcept
+        {
+            return this->writer_.UnsentBytes();
+        }
+
+        /**
+         * @brief Retrieve the number of messages written and sends issued on this connection
+         */
+        auto GetWriteStatistics() const noexcept -> ::Socket::WriteCoalescerStatistics
+        {
+            return this->writer_.GetStatistics();
         }
 
         void Close() noexcept
@@ -231,25 +427,35 @@ namespace ClientServer
         }
 
         /* Client side APIs */
+
+        /**
+         * @brief Connect to server, retrying on a fixed period until connected or closed
+         * 
+         * @param server 
+         * @param retry_period 
+         */
         void ConnectToServer(const Endpoint& server, Duration retry_period = 5s) noexcept
         {
-            ASRT_LOG_TRACE("Connecting to server");
+            this->ConnectToServer(server, ReconnectOptions{.initial_delay_ = retry_period, 
+                .max_delay_ = retry_period, .multiplier_ = 1.0, .jitter_ = 0.0});
+        }
+
+        /**
+         * @brief Connect to server, retrying with backoff until connected or closed
+         * 
+         * @param server 
+         * @param options delays between attempts
+         * @param delay before the first attempt
+         */
+        void ConnectToServer(const Endpoint& server, ReconnectOptions options, Duration delay = Duration::zero()) noexcept
+        {
             static_assert(IsClient(), "API for client use only!");
 
-            this->socket_.ConnectAsync(server, 
-                [self = this->shared_from_this(), server, retry_period](auto connect_result){
-                    if(connect_result.has_value()){
-                        spdlog::info("Connected to server {}", server);
-                        self->InitiateHandshake();
-                    }else{
-                        ASRT_LOG_INFO("Unable to connect to server, retrying in {}s", 
-                            std::chrono::duration_cast<std::chrono::seconds>(retry_period).count());
-                        self->executor_.PostDeferred(retry_period,
-                            [self, server, retry_period](){
-                                self->ConnectToServer(server, retry_period);
-                            });
-                    }
-                });
+            this->connect_backoff_ = internal::ReconnectBackoff{options};
+            if(delay == Duration::zero())
+                this->TryConnect(server);
+            else
+                this->RetryConnect(server, delay);
         }
 
         void InitiateHandshake() noexcept
@@ -289,6 +495,39 @@ namespace ClientServer
             return this->socket_.IsOpen();
         }
 
+        void TryConnect(const Endpoint& server) noexcept
+        {
+            ASRT_LOG_TRACE("Connecting to server");
+            this->socket_.ConnectAsync(server, 
+                [self = this->shared_from_this(), server](auto connect_result){
+                    if(connect_result.has_value()){
+                        spdlog::info("Connected to server {}", server);
+                        self->InitiateHandshake();
+                    }else{
+                        auto const delay{self->connect_backoff_.Next()};
+                        ASRT_LOG_INFO("Unable to connect to server, retrying in {}ms", 
+                            std::chrono::duration_cast<std::chrono::milliseconds>(delay).count());
+                        self->RetryConnect(server, delay);
+                    }
+                });
+        }
+
+        void RetryConnect(const Endpoint& server, Duration delay) noexcept
+        {
+            this->executor_.PostDeferred(delay,
+                [self = this->shared_from_this(), server](){
+                    if(!self->IsSocketOpen()) [[unlikely]] {
+                        ASRT_LOG_TRACE("Connection closed, no longer connecting to server");
+                        return;
+                    }
+                    self->TryConnect(server);
+                })
+            .map_error([](auto ec){
+                ASRT_LOG_ERROR("Unable to schedule connecting to server: {}", ec);
+                return ec;
+            });
+        }
+
         auto PrepareAuthInfo() noexcept
         {
             if constexpr (IsServer()){
@@ -298,51 +537,50 @@ namespace ClientServer
             }
         }
 
-        auto DoSendMessage2(const Message& message) noexcept {
-            ASRT_LOG_TRACE("Sending message...");
-            const bool send_in_progress{!this->outbox_.empty()};
-            this->outbox_.push_back(message);
-
-            if(send_in_progress || !this->IsConnectionValidated()) [[unlikely]]
-                return;
-
-            this->DoSendNextMessage();
+        auto DoWriteOrBacklog(ConstMessageView message_view) noexcept -> Result<void>
+        {
+            if(not this->backlog_pending_.load(std::memory_order::relaxed))
+                return this->Write(message_view);
+
+            ASRT_LOG_TRACE("Saved message while connection is being validated");
+            if(message_view.empty()) [[unlikely]] return Result<void>{};
+            if(this->backlog_.size() + message_view.size() > this->writer_.GetOptions().high_watermark_) [[unlikely]] {
+                ASRT_LOG_WARN("Connection {} backlog full, dropping message", GetId());
+                return MakeUnexpected(ErrorCode_Ns::ErrorCode::no_buffer_space);
+            }
+            Buffer::MutableBufferView const space{this->backlog_.Prepare(message_view.size())};
+            if(space.size() < message_view.size()) [[unlikely]]
+                return MakeUnexpected(ErrorCode_Ns::ErrorCode::no_memory);
+            std::memcpy(space.data(), message_view.data(), message_view.size());
+            this->backlog_.Commit(message_view.size());
+            return Result<void>{};
         }
-        
-        void DoSendNextMessage()  noexcept
+
+        auto WriteFrameToBacklog(std::array<std::uint8_t, FrameHeader::kLength> const& header, 
+            ConstMessageView prefix, ConstMessageView body) noexcept -> Result<void>
         {
-            ASRT_LOG_TRACE("Sending next message...");
-            const auto& msg{this->outbox_.front()};
-            this->socket_.SendAsync(msg.DataView(), 
-                [this](auto send_result){
-                    this->outbox_.pop_front();
-                    if(send_result.has_value()) [[likely]] {
-                        ASRT_LOG_TRACE("Sent sucess");
-                        if(!this->outbox_.empty()){
-                            this->strand_.Dispatch([this](){
-                                this->DoSendNextMessage();
-                            });
-                        }
-                    }else [[unlikely]] {
-                        ASRT_LOG_ERROR("Failed to send message");
-                        this->HandleCommunicationError(send_result.error());
-                    }
-                }); 
+            /* only while the connection is being validated, the message is assembled for the backlog */
+            std::vector<std::uint8_t> message(header.size() + prefix.size() + body.size());
+            std::memcpy(message.data(), header.data(), header.size());
+            if(!prefix.empty()) std::memcpy(message.data() + header.size(), prefix.data(), prefix.size());
+            if(!body.empty()) std::memcpy(message.data() + header.size() + prefix.size(), body.data(), body.size());
+            return this->Write(message);
         }
 
         void SendBackloggedMessages() noexcept
         {
-            ASRT_LOG_TRACE("Backlogged message(s) size {}", this->outbox_.size());
-            std::for_each(this->outbox_.begin(), this->outbox_.end(),
-                [this](auto& message){
-                    ASRT_LOG_TRACE("Sending backlogged message {}", spdlog::to_hex(message));
-                    this->socket_.SendSync(message.DataView())
-                    .map_error([&message](Socket::SockErrorCode ec){
-                        spdlog::warn("SendSync failed with {}, dropping backlogged message {}",
-                            ec, spdlog::to_hex(message));
-                    }); 
+            this->strand_.Dispatch(
+                [self = this->shared_from_this()](){
+                    ASRT_LOG_TRACE("Backlogged message(s) size {} bytes", self->backlog_.size());
+                    /* all backlogged messages leave with the same flush */
+                    self->writer_.Write(self->backlog_.Data())
+                    .map_error([](ErrorCode_Ns::ErrorCode ec){
+                        spdlog::warn("Write failed with {}, dropping backlogged messages", ec);
+                        return ec;
+                    });
+                    self->backlog_.Clear();
+                    self->backlog_pending_.store(false, std::memory_order::release);
                 });
-            this->outbox_.clear();  
         }
 
         [[deprecated]]
@@ -392,88 +630,72 @@ namespace ClientServer
                 });
         };
         
-        [[deprecated]] /* impl not ready */
-        void StartOfReceptionExperimental() noexcept{
-            this->socket_.ReceiveSomeAsync(this->incoming_message_.DataView(),
-            [self = this->shared_from_this(), this](auto recv_result){
-                if(recv_result.has_value()) [[likely]] {
-                    if(this->incoming_message_.CommitReception(recv_result.value())){
-                        this->FinalizeReception();
-                    }else{
-                        this->StartOfReceptionExperimental();
-                    }
-                }else [[unlikely]] {
-                    ASRT_LOG_ERROR("Failed to read message: {}, closing socket.",
-                        recv_result.error());
-                    this->HandleCommunicationError(recv_result.error());
-                }
-            });
-        }
-
-        void ReceiveMessageHeader() noexcept {
+        /**
+         * @brief Receive as much as is available into the frame reader and deliver every complete message received
+         */
+        void ReceiveMessages() noexcept
+        {
+            auto const space{this->reader_.Prepare()};
+            if(!space.has_value()) [[unlikely]] {
+                ASRT_LOG_ERROR("[Connection]: Unable to receive message: {}, closing socket.", space.error());
+                this->HandleCommunicationError(space.error());
+                return;
+            }
 
-            ASRT_LOG_TRACE("Connection attempting to receive {} bytes of message header", 
-                Message::HeaderLength());
-            this->incoming_message_.Resize(Message::HeaderLength());
-            this->socket_.ReceiveAsync(this->incoming_message_.HeaderView(), 
+            this->socket_.ReceiveSomeAsync(space.value(),
                 [self = this->shared_from_this(), this](auto recv_result) -> void {
                     if(recv_result.has_value()) [[likely]] {
-                        this->incoming_message_.CommitHeaderUpdate();
-                        if(this->incoming_message_.HasBody() > 0){
-                            this->ReceiveMessageBody();
-                        }else{ /* received zero-body message */
-                            ASRT_LOG_TRACE("Connection received header only message");
-                            this->FinalizeReception();
-                        }
+                        this->reader_.Commit(recv_result.value());
+                        this->DeliverMessages();
                     }else [[unlikely]] {
-                        ASRT_LOG_ERROR("Failed to read message header: {}, closing socket.",
+                        ASRT_LOG_ERROR("[Connection]: Failed to read message: {}, closing socket.",
                             recv_result.error());
                         this->HandleCommunicationError(recv_result.error());
                     }
-                }); 
+                });
         }
 
-        void ReceiveMessageBody() noexcept {
-            
-            //todo there is no need to break the receive up into two parts!!
-            //todo we should receive as much as we can and check if we received everything based on the length info contained in the message
-            //todo consider switching to receive some rather than receive
-
-            ASRT_LOG_TRACE("Receiving message body, size {:#x}", incoming_message_.BodyLength());
-            //const auto& header{this->outbox_.front().header};
-            this->socket_.ReceiveAsync(this->incoming_message_.BodyView(), 
-                [self = this->shared_from_this(), this](auto recv_result) -> void {
-                    if(recv_result.has_value()) [[likely]] {
-                        this->FinalizeReception();
-                    }else [[unlikely]] {
-                        ASRT_LOG_ERROR("[Connection]: Failed to read message body: {}, closing socket.",
-                            recv_result.error());
-                        this->HandleCommunicationError(recv_result.error());
-                    }
-                }); 
+        void DeliverMessages() noexcept
+        {
+            for(;;){
+                auto frame{this->reader_.Next()};
+                if(!frame.has_value()) [[unlikely]] {
+                    ASRT_LOG_ERROR("[Connection]: Received invalid message header: {}, closing socket.", frame.error());
+                    this->HandleCommunicationError(frame.error());
+                    return;
+                }
+                if(frame->Empty())
+                    break;
+                this->Deliver(std::move(frame.value()));
+            }
+            this->ReceiveMessages(); //prepare next read
         }
 
-        void FinalizeReception() noexcept
+        void Deliver(Frame&& frame) noexcept
         {
+            if constexpr (IsClient()){
+                /* replies complete their call right away, in polling mode as well */
+                if(frame.Type() == internal::kRpcResponseType){
+                    this->owner_.OnRpcResponse(std::move(frame));
+                    return;
+                }
+            }
+
             //todo can we get rid of the branching here
             if(inbox_){
-                this->inbox_->EmplaceBack(
-                    {this->shared_from_this(), std::move(this->incoming_message_)});
-                ASRT_LOG_TRACE("Enqueued message {}", spdlog::to_hex(this->incoming_message_));
+                ASRT_LOG_TRACE("Enqueued message {}", spdlog::to_hex(frame.Data()));
+                this->inbox_->Push({this->shared_from_this(), std::move(frame)});
             }else{
-                ASRT_LOG_TRACE("Delivering message {}", spdlog::to_hex(this->incoming_message_));
-                if constexpr (IsServer())
-                    this->owner_.OnMessage(
-                        this->shared_from_this(), this->incoming_message_);
-                else
-                    this->owner_.OnMessage(this->incoming_message_);
+                ASRT_LOG_TRACE("Delivering message {}", spdlog::to_hex(frame.Data()));
+                if constexpr (IsServer()){
+                    if(frame.Type() == internal::kRpcRequestType)
+                        this->owner_.OnRpcRequest(this->shared_from_this(), std::move(frame));
+                    else
+                        this->owner_.OnMessage(this->shared_from_this(), frame.Data());
+                }else{
+                    this->owner_.OnMessage(frame.Data());
+                }
             }
-            ASRT_LOG_TRACE("Connection {} message to {}",
-                inbox_ ? "enqueued" : "delivered",
-                IsClient() ? "client" : "server");
-            this->incoming_message_.Clear();
-
-            this->ReceiveMessageHeader(); //prepare next read
         }
 
         void HandleCommunicationError(ErrorCode_Ns::ErrorCode ec) noexcept
@@ -483,7 +705,8 @@ namespace ClientServer
                 this->owner_.OnConnectionError(this->shared_from_this(), ec);
             } else if constexpr (IsClient()){
                 ASRT_LOG_TRACE("Notifying client of connection error {}", ec);
-                this->owner_.OnConnectionError(ec);
+                /* null if a write fails while the connection is being destroyed */
+                this->owner_.OnConnectionError(this->weak_from_this().lock(), ec);
             }
           
             this->socket_.Close();   //todo          
@@ -533,7 +756,8 @@ namespace ClientServer
             .map([this](){
                     this->SetConnectionValidated();
                     this->SendBackloggedMessages(); //todo
-                    this->ReceiveMessageHeader();
+                    this->owner_.OnServerValidated(this->shared_from_this());
+                    this->ReceiveMessages();
             })
             .map_error([this](Socket::SockErrorCode ec){
                 ASRT_LOG_ERROR("Failed to send auth key, {}", ec);
@@ -554,7 +778,7 @@ namespace ClientServer
                             this->SetConnectionValidated();
                             this->SendBackloggedMessages();
                             this->owner_.OnClientValidated(self);
-                            this->ReceiveMessageHeader();
+                            this->ReceiveMessages();
                         }else{
                             using enum ErrorCode_Ns::ErrorCode;
                             ASRT_LOG_TRACE("Auth key validation error (received {:#0x}, expecting {:#0x}), closing socket.",
@@ -599,10 +823,14 @@ namespace ClientServer
         Executor& executor_;
         Strand strand_;
         Socket socket_{};
+        Writer writer_;
         ConnectionOwner& owner_;
         Inbox* inbox_;
         Outbox outbox_;
-        Message incoming_message_{};
+        Buffer::DynamicBuffer backlog_{};
+        std::atomic_bool backlog_pending_{true}; /* until the backlog has been handed to the writer */
+        Reader reader_{executor_, WireCodec{.max_payload_length_ = internal::kDefaultMaxBodyLength}};
+        internal::ReconnectBackoff connect_backoff_{}; /* client only */
 
         NetworkOrder<std::size_t> auth_seed_;
         NetworkOrder<std::size_t> auth_key_;
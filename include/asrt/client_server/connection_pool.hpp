@@ -0,0 +1,166 @@
+#ifndef D7A3B9E1_5C42_4F8E_A06D_9E2B7C41F853
+#define D7A3B9E1_5C42_4F8E_A06D_9E2B7C41F853
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "asrt/util.hpp"
+#include "asrt/error_code.hpp"
+#include "asrt/client_server/connection.hpp"
+
+namespace ClientServer
+{
+    /**
+     * @brief Keeps connections whose last reference was dropped for reuse by the next peer
+     * @details Acquire() hands out a connection through a shared pointer whose deleter recycles it into the pool
+     *  instead of destroying it, up to the pool capacity. Recycling closes the socket but retains its reactor slot,
+     *  the next accepted handle joins that slot with a single epoll_ctl(ADD) and the strand, write buffers and
+     *  reactor handler are reused as well. A pool of capacity 0 (the default) hands out ordinary connections.
+     *
+     * @tparam Connection eg: ClientServer::Connection
+     * @note Thread safe. Connections may be released after the pool is destroyed, they are destroyed then.
+     */
+    template <typename Connection>
+    class ConnectionPool
+    {
+    public:
+        using Executor          = typename Connection::ExecutorType;
+        using Owner             = typename Connection::OwnerType;
+        using ConnectionIdType  = typename Connection::ConnectionIdType;
+        using WriteOptions      = typename Connection::WriteOptions;
+        using ConnectionPtr     = std::shared_ptr<Connection>;
+
+        ConnectionPool() noexcept : storage_{std::make_shared<Storage>()} {}
+
+        ConnectionPool(ConnectionPool const&) = delete;
+        ConnectionPool(ConnectionPool&&) = delete;
+        ConnectionPool &operator=(ConnectionPool const &other) = delete;
+        ConnectionPool &operator=(ConnectionPool &&other) = delete;
+
+        ~ConnectionPool() noexcept
+        {
+            IdleConnections released;
+            {
+                std::scoped_lock const lock{this->storage_->mtx_};
+                this->storage_->open_ = false;
+                released.swap(this->storage_->idle_);
+            }
+        }
+
+        /**
+         * @brief Set the number of connections kept for reuse and construct the missing ones ahead of time
+         *
+         * @param capacity 0 disables pooling
+         * @param executor executor of the constructed connections
+         * @param owner owner of the constructed connections
+         */
+        void Reserve(std::size_t capacity, Executor& executor, Owner& owner) noexcept
+        {
+            IdleConnections released;
+            std::scoped_lock const lock{this->storage_->mtx_};
+            this->storage_->capacity_ = capacity;
+            auto& idle{this->storage_->idle_};
+            while(idle.size() > capacity){
+                released.emplace_back(std::move(idle.back()));
+                idle.pop_back();
+            }
+            idle.reserve(capacity);
+            while(idle.size() < capacity){
+                idle.emplace_back(this->Construct(executor, owner, 0));
+            }
+        }
+
+        /**
+         * @brief Take a recycled connection, or construct one if none is idle
+         *
+         * @param executor used if a connection is constructed
+         * @param owner used if a connection is constructed
+         * @param conn_id assigned to the connection
+         * @param write_options applied to the connection
+         * @return ConnectionPtr recycled into the pool once the last reference is dropped
+         */
+        auto Acquire(Executor& executor, Owner& owner, ConnectionIdType conn_id, WriteOptions write_options = {}) noexcept
+            -> ConnectionPtr
+        {
+            std::unique_ptr<Connection> connection;
+            {
+                std::scoped_lock const lock{this->storage_->mtx_};
+                if(this->storage_->capacity_ == 0u) [[unlikely]] /* pooling disabled */
+                    return Connection::Create(executor, owner, conn_id, write_options);
+
+                if(!this->storage_->idle_.empty()){
+                    connection = std::move(this->storage_->idle_.back());
+                    this->storage_->idle_.pop_back();
+                }
+            }
+
+            if(connection){
+                connection->Reuse(conn_id, write_options);
+            }else{
+                ASRT_LOG_TRACE("[ConnectionPool]: No idle connection, constructing connection {}", conn_id);
+                connection = this->Construct(executor, owner, conn_id, write_options);
+            }
+            return ConnectionPtr{connection.release(), Recycler{this->storage_}};
+        }
+
+        /**
+         * @brief Number of connections ready for reuse
+         */
+        std::size_t IdleCount() const noexcept
+        {
+            std::scoped_lock const lock{this->storage_->mtx_};
+            return this->storage_->idle_.size();
+        }
+
+        std::size_t Capacity() const noexcept
+        {
+            std::scoped_lock const lock{this->storage_->mtx_};
+            return this->storage_->capacity_;
+        }
+
+    private:
+        using MutexType = typename Executor::MutexType;
+        using IdleConnections = std::vector<std::unique_ptr<Connection>>;
+
+        /* outlives the pool for as long as connections handed out by it are alive */
+        struct Storage
+        {
+            mutable MutexType mtx_;
+            IdleConnections idle_{};
+            std::size_t capacity_{0u};
+            bool open_{true};
+        };
+
+        struct Recycler
+        {
+            void operator()(Connection* released) const noexcept
+            {
+                std::unique_ptr<Connection> connection{released}; /* destroyed unless kept */
+                connection->Recycle();
+
+                std::scoped_lock const lock{this->storage_->mtx_};
+                if(this->storage_->open_ && this->storage_->idle_.size() < this->storage_->capacity_) [[likely]] {
+                    this->storage_->idle_.emplace_back(std::move(connection));
+                }
+            }
+
+            std::shared_ptr<Storage> storage_;
+        };
+
+        static auto Construct(Executor& executor, Owner& owner, ConnectionIdType conn_id, WriteOptions write_options = {}) noexcept
+            -> std::unique_ptr<Connection>
+        {
+            auto connection{std::make_unique<Connection>(executor, owner, conn_id, write_options)};
+            connection->GetSocket().RetainReactorSlot();
+            return connection;
+        }
+
+        std::shared_ptr<Storage> storage_;
+    };
+
+} //end ns
+
+#endif /* D7A3B9E1_5C42_4F8E_A06D_9E2B7C41F853 */
@@ -0,0 +1,176 @@
+#ifndef F2B8C6D4_91A7_4E3C_B5D0_3A6E8F1C2D79
+#define F2B8C6D4_91A7_4E3C_B5D0_3A6E8F1C2D79
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ClientServer
+{
+    namespace internal
+    {
+        static constexpr std::size_t kDefaultRegistryShards{16u};
+        static constexpr std::size_t kRegistryShardAlign{64u}; /* one cache line per shard lock */
+    }
+
+    /**
+     * @brief Active connections keyed by connection id, spread over independently locked shards
+     * @details Lookup, insertion and removal of a connection only lock the shard its id maps to, so routing a message
+     *  to a client is O(1) and contends with nothing but traffic on the same shard. Iterating all connections goes
+     *  through an immutable snapshot instead (read-copy-update): readers share the current snapshot and iterate it
+     *  without holding any lock, the snapshot is rebuilt by the first reader after the set of connections changed.
+     *  A removed connection stays alive until the readers still iterating a snapshot containing it are done.
+     *
+     * @tparam Connection eg: ClientServer::Connection
+     * @tparam MutexType lock of each shard
+     * @tparam kShards number of shards, a power of two
+     * @note Thread safe. No lock is held while the caller works on a connection it looked up.
+     */
+    template <typename Connection, typename MutexType, std::size_t kShards = internal::kDefaultRegistryShards>
+    class ConnectionRegistry
+    {
+        static_assert(kShards > 0u && (kShards & (kShards - 1u)) == 0u, "Shard count must be a power of two!");
+    public:
+        using ConnectionPtr     = std::shared_ptr<Connection>;
+        using ConnectionIdType  = typename Connection::ConnectionIdType;
+        using Snapshot          = std::shared_ptr<std::vector<ConnectionPtr> const>;
+
+        ConnectionRegistry() noexcept = default;
+
+        ConnectionRegistry(ConnectionRegistry const&) = delete;
+        ConnectionRegistry(ConnectionRegistry&&) = delete;
+        ConnectionRegistry &operator=(ConnectionRegistry const &other) = delete;
+        ConnectionRegistry &operator=(ConnectionRegistry &&other) = delete;
+        ~ConnectionRegistry() noexcept = default;
+
+        /**
+         * @brief Add a connection under its id
+         *
+         * @param connection
+         * @return true if added, false if a connection with the same id is already registered
+         */
+        bool Insert(ConnectionPtr connection) noexcept
+        {
+            ConnectionIdType const conn_id{connection->GetId()};
+            Shard& shard{this->ShardOf(conn_id)};
+            {
+                std::scoped_lock const lock{shard.mtx_};
+                if(!shard.connections_.try_emplace(conn_id, std::move(connection)).second) [[unlikely]]
+                    return false;
+            }
+            this->size_.fetch_add(1u, std::memory_order_relaxed);
+            this->version_.fetch_add(1u, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Remove the connection with the given id
+         * @details The current snapshot is retired as well, the removed connection is destroyed once the last
+         *  reader iterating it is done and the caller has dropped the returned reference.
+         *
+         * @param conn_id
+         * @return ConnectionPtr the removed connection, empty if none was registered under conn_id
+         */
+        auto Erase(ConnectionIdType conn_id) noexcept -> ConnectionPtr
+        {
+            ConnectionPtr removed;
+            Shard& shard{this->ShardOf(conn_id)};
+            {
+                std::scoped_lock const lock{shard.mtx_};
+                auto const it{shard.connections_.find(conn_id)};
+                if(it == shard.connections_.end())
+                    return removed;
+                removed = std::move(it->second);
+                shard.connections_.erase(it);
+            }
+            this->size_.fetch_sub(1u, std::memory_order_relaxed);
+            this->version_.fetch_add(1u, std::memory_order_release);
+
+            Snapshot retired;
+            {
+                std::scoped_lock const lock{this->snapshot_mtx_};
+                retired = std::move(this->snapshot_);
+            }
+            return removed;
+        }
+
+        /**
+         * @brief Look up the connection with the given id
+         *
+         * @param conn_id
+         * @return ConnectionPtr empty if none is registered under conn_id
+         */
+        auto Find(ConnectionIdType conn_id) const noexcept -> ConnectionPtr
+        {
+            Shard const& shard{this->ShardOf(conn_id)};
+            std::scoped_lock const lock{shard.mtx_};
+            auto const it{shard.connections_.find(conn_id)};
+            return it != shard.connections_.end() ? it->second : ConnectionPtr{};
+        }
+
+        /**
+         * @brief The connections registered at the time of the call, to be iterated without locking
+         * @details Reuses the current snapshot unless the set of connections changed since it was taken.
+         */
+        auto GetSnapshot() noexcept -> Snapshot
+        {
+            Snapshot retired; /* released after unlocking */
+            std::scoped_lock const lock{this->snapshot_mtx_};
+            std::uint64_t const version{this->version_.load(std::memory_order_acquire)};
+            if(this->snapshot_ && this->snapshot_version_ == version) [[likely]]
+                return this->snapshot_;
+
+            auto connections{std::make_shared<std::vector<ConnectionPtr>>()};
+            connections->reserve(this->Size());
+            for(Shard const& shard : this->shards_){
+                std::scoped_lock const shard_lock{shard.mtx_};
+                for(auto const& [conn_id, connection] : shard.connections_)
+                    connections->emplace_back(connection);
+            }
+
+            /* changes made while collecting are picked up by the next rebuild */
+            retired = std::exchange(this->snapshot_, std::move(connections));
+            this->snapshot_version_ = version;
+            return this->snapshot_;
+        }
+
+        std::size_t Size() const noexcept { return this->size_.load(std::memory_order_relaxed); }
+
+        bool Empty() const noexcept { return this->Size() == 0u; }
+
+    private:
+        struct alignas(internal::kRegistryShardAlign) Shard
+        {
+            mutable MutexType mtx_;
+            std::unordered_map<ConnectionIdType, ConnectionPtr> connections_{};
+        };
+
+        Shard& ShardOf(ConnectionIdType conn_id) noexcept
+        {
+            /* ids are handed out sequentially, consecutive clients land on consecutive shards */
+            return this->shards_[static_cast<std::size_t>(conn_id) & (kShards - 1u)];
+        }
+
+        Shard const& ShardOf(ConnectionIdType conn_id) const noexcept
+        {
+            return this->shards_[static_cast<std::size_t>(conn_id) & (kShards - 1u)];
+        }
+
+        std::array<Shard, kShards> shards_{};
+        std::atomic<std::size_t> size_{0u};
+        std::atomic<std::uint64_t> version_{0u}; /* bumped on every insertion and removal */
+
+        MutexType snapshot_mtx_;
+        Snapshot snapshot_{};
+        std::uint64_t snapshot_version_{0u};
+    };
+
+} //end ns
+
+#endif /* F2B8C6D4_91A7_4E3C_B5D0_3A6E8F1C2D79 */
@@ -0,0 +1,250 @@
+#ifndef E0C4A7B2_6D19_4F38_9B5E_1A8D3F72C6E4
+#define E0C4A7B2_6D19_4F38_9B5E_1A8D3F72C6E4
+
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <utility>
+
+#include "asrt/error_code.hpp"
+#include "asrt/netbuffer.hpp"
+#include "asrt/client_server/message_schema.hpp"
+#include "asrt/socket/basic_stream_socket.hpp"
+
+namespace ClientServer
+{
+    using Util::Expected_NS::MakeUnexpected;
+    using asrt::Result;
+
+    namespace internal
+    {
+        /* pooled receive buffer size, frames up to this size are received together with their neighbours */
+        static constexpr std::size_t kDefaultReceiveBufferSize{16384u};
+        /* free space below which the partial frame moves to a fresh receive buffer rather than receiving into the tail */
+        static constexpr std::size_t kMinReceiveSpace{512u};
+        /* frames announcing a larger body are rejected with message_size */
+        static constexpr std::size_t kDefaultMaxBodyLength{std::size_t{16u} << 20u};
+    }
+
+    /**
+     * @brief Wire format of client_server messages: one byte message type, big endian 32 bit body length, body
+     */
+    using WireCodec = ::Socket::LengthPrefixCodec<std::uint32_t, 1u>;
+
+    using FrameHeaderLayout = MessageLayout<
+        MessageField<"type", std::uint8_t>,
+        MessageField<"body_length", std::uint32_t>>;
+
+    static_assert(FrameHeaderLayout::kSize == WireCodec::HeaderLength(), "Frame header layout does not match the wire codec!");
+
+    struct FrameHeader
+    {
+        static constexpr std::size_t kLength{FrameHeaderLayout::kSize};
+
+        std::uint8_t type_{};
+        std::uint32_t body_length_{};
+
+        static FrameHeader Decode(std::uint8_t const* data) noexcept
+        {
+            auto const [type, body_length]{FrameHeaderLayout::DecodeUnchecked(data)};
+            return FrameHeader{type, body_length};
+        }
+
+        auto Encode() const noexcept -> std::array<std::uint8_t, kLength>
+        {
+            return FrameHeaderLayout::Encode(this->type_, this->body_length_);
+        }
+    };
+
+    /**
+     * @brief A received frame, viewed in place in the pooled buffer it was received into
+     * @details Holds a reference to the buffer, so the views stay valid for as long as the frame or a copy of it
+     *  is alive. Copying a frame copies no data.
+     */
+    class Frame
+    {
+    public:
+        using ConstView = std::span<std::uint8_t const>;
+
+        Frame() noexcept = default;
+
+        Frame(Buffer::PooledBuffer buffer, std::size_t offset, std::size_t length, std::size_t header_length) noexcept
+            : buffer_{std::move(buffer)}, offset_{offset}, length_{length}, header_length_{header_length} {}
+
+        /* Whether this frame refers to any data */
+        [[nodiscard]] bool Empty() const noexcept { return !this->buffer_; }
+
+        /* Header followed by body */
+        ConstView Data() const noexcept { return {this->buffer_.data() + this->offset_, this->length_}; }
+
+        ConstView Header() const noexcept { return this->Data().first(this->header_length_); }
+
+        ConstView Body() const noexcept { return this->Data().subspan(this->header_length_); }
+
+        std::size_t BodyLength() const noexcept { return this->length_ - this->header_length_; }
+
+        /* Message type of a frame in the client_server wire format */
+        std::uint8_t Type() const noexcept { return this->Data()[0]; }
+
+        /**
+         * @brief View the body in place as a message laid out as Layout, eg: a MessageLayout
+         *
+         * @return Result<typename Layout::View> read_insufficient_data if the body is shorter than the layout
+         */
+        template <typename Layout>
+        auto BodyAs() const noexcept -> Result<typename Layout::View>
+        {
+            return Layout::Decode(this->Body());
+        }
+
+        /* The pooled buffer holding the frame, among other frames received with it */
+        Buffer::PooledBuffer const& GetBuffer() const noexcept { return this->buffer_; }
+
+        operator ConstView() const noexcept { return this->Data(); }
+
+    private:
+        Buffer::PooledBuffer buffer_{};
+        std::size_t offset_{0u};
+        std::size_t length_{0u};
+        std::size_t header_length_{0u};
+    };
+
+    /**
+     * @brief Splits a byte stream into frames without copying them out of the buffers they were received into
+     * @details Data is received straight into a pooled buffer through Prepare() and Commit(), Next() then decodes
+     *  the frame headers in place and hands out each complete frame as a view sharing the buffer. A receive
+     *  thereby yields as many frames as arrived with it. Once the tail of the buffer is too small for the next
+     *  frame, its received part moves to a fresh pooled buffer; the old buffer returns to the pool when the
+     *  last of its frames is released, or is rewound in place if no frame was kept. In steady state nothing is
+     *  allocated apart from frames larger than the largest pool size class.
+     *
+     * @tparam Executor allocates the pooled buffers
+     * @tparam Codec delimits the frames, eg: WireCodec
+     * @note Not thread safe. Frames handed out may be used from any thread.
+     */
+    template <typename Executor, ::Socket::FrameCodec Codec = WireCodec>
+    class FrameReader
+    {
+    public:
+        explicit FrameReader(Executor& executor, Codec codec = {},
+            std::size_t buffer_size = internal::kDefaultReceiveBufferSize) noexcept
+            : executor_{executor}, codec_{codec}, buffer_size_{buffer_size} {}
+
+        /**
+         * @brief Space to receive into, large enough for the rest of the frame in progress if its header is complete
+         *
+         * @return Result<Buffer::MutableBufferView> the error of an invalid frame header,
+         *  or no_memory if no receive buffer could be allocated
+         */
+        auto Prepare() noexcept -> Result<Buffer::MutableBufferView>
+        {
+            std::size_t const buffered{this->write_ - this->read_};
+            if(buffered == 0u && this->buffer_ && this->buffer_.UseCount() == 1u) [[likely]] {
+                this->read_ = this->write_ = 0u; /* no frame kept, start over in place */
+            }
+
+            std::size_t required{this->codec_.HeaderLength()};
+            if(buffered >= required){
+                auto const frame_length{this->codec_.FrameLength(
+                    {this->buffer_.data() + this->read_, this->codec_.HeaderLength()})};
+                if(!frame_length.has_value()) [[unlikely]]
+                    return MakeUnexpected(frame_length.error());
+                required = frame_length.value();
+            }
+
+            std::size_t const capacity{this->buffer_.Capacity()};
+            /* a small tail is only given up if little has to be moved */
+            if(this->read_ + required > capacity ||
+                (capacity - this->write_ < internal::kMinReceiveSpace && buffered < internal::kMinReceiveSpace)) [[unlikely]] {
+                if(auto const result{this->Relocate(required)}; !result.has_value()) [[unlikely]]
+                    return MakeUnexpected(result.error());
+            }
+            return Buffer::MutableBufferView{this->buffer_.data() + this->write_, this->buffer_.Capacity() - this->write_};
+        }
+
+        /**
+         * @brief Account for bytes received into the space returned by Prepare()
+         */
+        void Commit(std::size_t received) noexcept
+        {
+            assert(this->write_ + received <= this->buffer_.Capacity());
+            this->write_ += received;
+        }
+
+        /**
+         * @brief Take the next complete frame out of the received data
+         *
+         * @return Result<Frame> an empty frame if no complete frame was received yet,
+         *  or the error of an invalid frame header
+         */
+        auto Next() noexcept -> Result<Frame>
+        {
+            std::size_t const buffered{this->write_ - this->read_};
+            if(buffered < this->codec_.HeaderLength())
+                return Frame{};
+
+            auto const frame_length{this->codec_.FrameLength(
+                {this->buffer_.data() + this->read_, this->codec_.HeaderLength()})};
+            if(!frame_length.has_value()) [[unlikely]]
+                return MakeUnexpected(frame_length.error());
+            if(buffered < frame_length.value())
+                return Frame{};
+
+            Frame frame{this->buffer_, this->read_, frame_length.value(), this->codec_.HeaderLength()};
+            this->read_ += frame_length.value();
+            return frame;
+        }
+
+        /**
+         * @brief Received bytes not handed out as frames yet
+         */
+        std::size_t Buffered() const noexcept { return this->write_ - this->read_; }
+
+        /**
+         * @brief Drop the received data and the receive buffer, eg: before reading from another peer
+         */
+        void Reset() noexcept
+        {
+            this->buffer_.Reset();
+            this->read_ = this->write_ = 0u;
+        }
+
+    private:
+        /**
+         * @brief Move the frame in progress to the start of a buffer able to hold required bytes
+         */
+        auto Relocate(std::size_t required) noexcept -> Result<void>
+        {
+            std::size_t const buffered{this->write_ - this->read_};
+            if(this->buffer_ && this->buffer_.UseCount() == 1u && this->buffer_.Capacity() >= required){
+                std::memmove(this->buffer_.data(), this->buffer_.data() + this->read_, buffered);
+            }else{
+                /* frames still refer to the current buffer, or it is too small */
+                Buffer::PooledBuffer buffer{this->executor_.AllocateBuffer(
+                    required > this->buffer_size_ ? required : this->buffer_size_)};
+                if(!buffer) [[unlikely]]
+                    return MakeUnexpected(asrt::ErrorCodeType::no_memory);
+                if(buffered != 0u)
+                    std::memcpy(buffer.data(), this->buffer_.data() + this->read_, buffered);
+                this->buffer_ = std::move(buffer);
+            }
+            this->read_ = 0u;
+            this->write_ = buffered;
+            return Result<void>{};
+        }
+
+        Executor& executor_;
+        Codec codec_;
+        std::size_t buffer_size_;
+        Buffer::PooledBuffer buffer_{};
+        std::size_t read_{0u}; /* start of the first frame not handed out */
+        std::size_t write_{0u}; /* end of the received data */
+    };
+
+} //end ns
+
+#endif /* E0C4A7B2_6D19_4F38_9B5E_1A8D3F72C6E4 */
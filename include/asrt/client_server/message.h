@@ -12,6 +12,7 @@
 
 #include "asrt/netbuffer.hpp"
 #include "asrt/socket/address_types.hpp"
+#include "asrt/client_server/message_schema.hpp"
 
 namespace ClientServer
 {
@@ -70,12 +71,17 @@ inline auto ToString(MessageType type) -> std::string
     return printable;
 }
 
-std::ostream& operator<<(std::ostream& os, const MessageType& type)
+inline std::ostream& operator<<(std::ostream& os, const MessageType& type)
 {
     os << ToString(type);
     return os;
 }
 
+/* wire layout of the message header, see MessageLayout */
+using MessageHeaderLayout = MessageLayout<
+    MessageField<"type", MessageType>,
+    MessageField<"body_length", std::uint32_t>>;
+
 struct MessageHeader2
 {
     MessageType type_;
@@ -101,7 +107,7 @@ struct MessageHeader2
 
 union MessageHeader
 {
-    static constexpr std::size_t header_length_{5u};
+    static constexpr std::size_t header_length_{MessageHeaderLayout::kSize};
     struct{
         NetworkOrder<std::uint32_t> type_;
         NetworkOrder<std::uint32_t> body_length_;
@@ -217,9 +223,9 @@ struct GenericMessage
 struct GenericMessage2
 {
 public:
-    static constexpr std::uint8_t kDiagMsgHeaderLength{5u};
-    static constexpr std::uint8_t kDiagMsgTypeOffset{0u};
-    static constexpr std::uint8_t kDiagMsgBodyLenOffset{1u};
+    static constexpr std::uint8_t kDiagMsgHeaderLength{MessageHeaderLayout::kSize};
+    static constexpr std::uint8_t kDiagMsgTypeOffset{MessageHeaderLayout::OffsetOf<"type">()};
+    static constexpr std::uint8_t kDiagMsgBodyLenOffset{MessageHeaderLayout::OffsetOf<"body_length">()};
 
     using MessageHeaderType = MessageHeader;
     using MsgType = MessageType;
@@ -231,11 +237,9 @@ public:
         : type_{type}
     {
         this->payload_len_ = static_cast<std::uint32_t>(::strlen(payload) + 1u);
-        const NetworkOrder<std::uint32_t> payload_len_net{this->payload_len_};
 
         this->data_.resize(kDiagMsgHeaderLength + this->payload_len_);
-        std::memcpy(this->data_.data(), &type, sizeof(MessageType));
-        std::memcpy(this->data_.data() + sizeof(MessageType), payload_len_net.data(), sizeof(payload_len_net));
+        MessageHeaderLayout::EncodeUnchecked(this->data_.data(), type, this->payload_len_);
         std::memcpy(this->data_.data() + kDiagMsgHeaderLength, payload, this->payload_len_);
         ASRT_LOG_TRACE("Message construction, total size {}, payload len: {} bytes", 
             this->data_.size(), this->payload_len_);
@@ -273,10 +277,7 @@ public:
         if(this->data_.size() < kDiagMsgHeaderLength)
             return;
 
-        NetworkOrder<std::uint32_t> payload_length;
-        this->type_ = static_cast<MsgType>(this->data_[kDiagMsgTypeOffset]);
-        std::memcpy(payload_length.data(), data_.data() + kDiagMsgBodyLenOffset, sizeof(this->payload_len_)); 
-        this->payload_len_ = payload_length.ToHost();
+        std::tie(this->type_, this->payload_len_) = MessageHeaderLayout::DecodeUnchecked(this->data_.data());
     }
 
     auto BodyLength() const -> std::size_t
@@ -1,7 +1,9 @@
 #ifndef D6450F73_8046_4269_9ADD_01C69359F675
 #define D6450F73_8046_4269_9ADD_01C69359F675
 
+#include <cassert>
 #include <cstdint>
+#include <condition_variable>
 #include <deque>
 #include <mutex>
 
@@ -35,7 +37,7 @@ namespace ClientServer
         {
             std::scoped_lock const lock{this->mtx_};
             T item{std::move(this->queue_.front())};
-            this->queue_.pop_back();
+            this->queue_.pop_front();
             return item;
         }
 
@@ -46,7 +48,7 @@ namespace ClientServer
                 return !this->queue_.empty();
             });
             T item{std::move(this->queue_.front())};
-            this->queue_.pop_back();
+            this->queue_.pop_front();
             return item;
         }
 
@@ -56,7 +58,7 @@ namespace ClientServer
             this->queue_.push_back(item);
         }
 
-        void EmplaceBack(const T& item) noexcept
+        void EmplaceBack(T&& item) noexcept
         {
             std::scoped_lock const lock{this->mtx_};
             this->queue_.emplace_back(std::move(item));
@@ -0,0 +1,381 @@
+#ifndef D4A9E6C1_3B72_4F05_8C1D_92E7A5F03B68
+#define D4A9E6C1_3B72_4F05_8C1D_92E7A5F03B68
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "asrt/common_types.hpp"
+#include "asrt/error_code.hpp"
+#include "asrt/details/byte_scan.hpp"
+
+namespace ClientServer
+{
+    using Util::Expected_NS::MakeUnexpected;
+    using asrt::Result;
+
+    namespace internal
+    {
+        /**
+         * @brief Name of a message field, usable as template argument, eg: MessageField<"sequence", std::uint32_t>
+         */
+        template <std::size_t N>
+        struct FieldName
+        {
+            constexpr FieldName(char const (&name)[N]) noexcept { std::copy_n(name, N, this->value_); }
+
+            constexpr std::string_view View() const noexcept { return {this->value_, N - 1u}; }
+
+            template <std::size_t M>
+            constexpr bool operator==(FieldName<M> const& other) const noexcept { return this->View() == other.View(); }
+
+            char value_[N]{};
+        };
+
+        template <typename T>
+        struct WireTraits
+        {
+            static_assert(sizeof(T) == 0u, "Unsupported message field type!");
+        };
+
+        /* integers are sent in network byte order */
+        template <typename T>
+            requires std::is_integral_v<T> && (!std::is_same_v<T, bool>)
+        struct WireTraits<T>
+        {
+            using UInt = std::make_unsigned_t<T>;
+            using ValueType = T;
+            static constexpr std::size_t kSize{sizeof(T)};
+
+            static constexpr ValueType Load(std::uint8_t const* data) noexcept
+            {
+                if(std::is_constant_evaluated()){
+                    UInt value{0u};
+                    for(std::size_t i{0u}; i < kSize; ++i)
+                        value = static_cast<UInt>((value << 8u) | data[i]);
+                    return static_cast<T>(value);
+                }
+                return static_cast<T>(asrt::details::LoadBigEndian<UInt>(data));
+            }
+
+            static constexpr void Store(std::uint8_t* data, ValueType value) noexcept
+            {
+                if(std::is_constant_evaluated()){
+                    auto bits{static_cast<UInt>(value)};
+                    for(std::size_t i{kSize}; i-- > 0u; bits = static_cast<UInt>(bits >> 8u))
+                        data[i] = static_cast<std::uint8_t>(bits & 0xFFu);
+                    return;
+                }
+                asrt::details::StoreBigEndian(data, static_cast<UInt>(value));
+            }
+        };
+
+        template <>
+        struct WireTraits<bool>
+        {
+            using ValueType = bool;
+            static constexpr std::size_t kSize{1u};
+
+            static constexpr ValueType Load(std::uint8_t const* data) noexcept { return data[0] != 0u; }
+            static constexpr void Store(std::uint8_t* data, ValueType value) noexcept { data[0] = value ? 1u : 0u; }
+        };
+
+        /* enumerations are sent as their underlying integer */
+        template <typename T>
+            requires std::is_enum_v<T>
+        struct WireTraits<T>
+        {
+            using Underlying = WireTraits<std::underlying_type_t<T>>;
+            using ValueType = T;
+            static constexpr std::size_t kSize{Underlying::kSize};
+
+            static constexpr ValueType Load(std::uint8_t const* data) noexcept { return static_cast<T>(Underlying::Load(data)); }
+
+            static constexpr void Store(std::uint8_t* data, ValueType value) noexcept
+            {
+                Underlying::Store(data, static_cast<std::underlying_type_t<T>>(value));
+            }
+        };
+
+        /* IEEE 754 values are sent as their bit pattern in network byte order */
+        template <typename T>
+            requires std::is_floating_point_v<T> && (sizeof(T) == 4u || sizeof(T) == 8u)
+        struct WireTraits<T>
+        {
+            using Bits = std::conditional_t<sizeof(T) == 4u, std::uint32_t, std::uint64_t>;
+            using ValueType = T;
+            static constexpr std::size_t kSize{sizeof(T)};
+
+            static constexpr ValueType Load(std::uint8_t const* data) noexcept
+            {
+                return std::bit_cast<T>(WireTraits<Bits>::Load(data));
+            }
+
+            static constexpr void Store(std::uint8_t* data, ValueType value) noexcept
+            {
+                WireTraits<Bits>::Store(data, std::bit_cast<Bits>(value));
+            }
+        };
+
+        /* fixed size byte strings are read in place */
+        template <std::size_t N>
+        struct WireTraits<std::array<std::uint8_t, N>>
+        {
+            using ValueType = std::span<std::uint8_t const, N>;
+            static constexpr std::size_t kSize{N};
+
+            static constexpr ValueType Load(std::uint8_t const* data) noexcept { return ValueType{data, N}; }
+
+            static constexpr void Store(std::uint8_t* data, ValueType value) noexcept { std::copy_n(value.data(), N, data); }
+        };
+    }
+
+    /**
+     * @brief One fixed size field of a message layout
+     *
+     * @tparam Name to access the field by
+     * @tparam T integer, bool, enumeration, float, double or std::array<std::uint8_t, N>
+     */
+    template <internal::FieldName Name, typename T>
+    struct MessageField
+    {
+        using Traits = typename internal::WireTraits<T>;
+        using Type = T;
+        using ValueType = typename Traits::ValueType; /* what accessors return, a view for byte strings */
+
+        static constexpr auto kName{Name};
+        static constexpr std::size_t kSize{Traits::kSize};
+    };
+
+    template <typename Layout>
+    class MessageView;
+
+    template <typename Layout>
+    class MutableMessageView;
+
+    /**
+     * @brief Wire layout of a message, described once as a list of fields
+     * @details Fields are packed back to back in declaration order, without padding, in network byte order.
+     *  Field offsets, the fixed size of the message and the field lookup by name are resolved at compile time,
+     *  decoding a message is therefore nothing but a bounds check followed by loads at constant offsets from the
+     *  received bytes, which are read in place. Bytes following the fixed fields are available as Tail(),
+     *  eg: for a variable length payload.
+     *
+     * @tparam Fields MessageField...
+     * @example
+     *  using Quote = MessageLayout<MessageField<"id", std::uint32_t>, MessageField<"price", double>>;
+     *  auto quote{Quote::Decode(frame.Body())};
+     *  if(quote.has_value()) Handle(quote->Get<"id">(), quote->Get<"price">());
+     */
+    template <typename... Fields>
+    class MessageLayout
+    {
+        static constexpr std::array<std::string_view, sizeof...(Fields)> kNames{Fields::kName.View()...};
+        static constexpr std::array<std::size_t, sizeof...(Fields)> kSizes{Fields::kSize...};
+
+        static constexpr auto ComputeOffsets() noexcept
+        {
+            std::array<std::size_t, sizeof...(Fields)> offsets{};
+            std::size_t offset{0u};
+            for(std::size_t i{0u}; i < sizeof...(Fields); ++i){
+                offsets[i] = offset;
+                offset += kSizes[i];
+            }
+            return offsets;
+        }
+
+        static constexpr bool HasUniqueNames() noexcept
+        {
+            for(std::size_t i{0u}; i < sizeof...(Fields); ++i)
+                for(std::size_t j{i + 1u}; j < sizeof...(Fields); ++j)
+                    if(kNames[i] == kNames[j]) return false;
+            return true;
+        }
+
+        static_assert(HasUniqueNames(), "Message field names must be unique!");
+
+        static constexpr std::array<std::size_t, sizeof...(Fields)> kOffsets{ComputeOffsets()};
+
+    public:
+        using View          = MessageView<MessageLayout>;
+        using MutableView   = MutableMessageView<MessageLayout>;
+        using Values        = std::tuple<typename Fields::ValueType...>;
+
+        static constexpr std::size_t kFieldCount{sizeof...(Fields)};
+        /* length of the fixed fields, the minimum length of a message */
+        static constexpr std::size_t kSize{(std::size_t{0u} + ... + Fields::kSize)};
+
+        template <internal::FieldName Name>
+        static constexpr std::size_t IndexOf() noexcept
+        {
+            constexpr std::size_t index{static_cast<std::size_t>(
+                std::find(kNames.begin(), kNames.end(), Name.View()) - kNames.begin())};
+            static_assert(index < sizeof...(Fields), "No message field with this name!");
+            return index;
+        }
+
+        template <std::size_t kIndex>
+        using FieldAt = std::tuple_element_t<kIndex, std::tuple<Fields...>>;
+
+        template <internal::FieldName Name>
+        using FieldOf = FieldAt<IndexOf<Name>()>;
+
+        template <internal::FieldName Name>
+        static constexpr std::size_t OffsetOf() noexcept { return kOffsets[IndexOf<Name>()]; }
+
+        /**
+         * @brief View a received message in place
+         *
+         * @param data the message, at least kSize bytes
+         * @return Result<View> read_insufficient_data if data is shorter than the fixed fields
+         */
+        static auto Decode(std::span<std::uint8_t const> data) noexcept -> Result<View>
+        {
+            if(data.size() < kSize) [[unlikely]]
+                return MakeUnexpected(asrt::ErrorCodeType::read_insufficient_data);
+            return View{data};
+        }
+
+        /**
+         * @brief View a message to be filled in place
+         *
+         * @param data at least kSize bytes
+         * @return Result<MutableView> truncation if data is shorter than the fixed fields
+         */
+        static auto Prepare(std::span<std::uint8_t> data) noexcept -> Result<MutableView>
+        {
+            if(data.size() < kSize) [[unlikely]]
+                return MakeUnexpected(asrt::ErrorCodeType::truncation);
+            return MutableView{data};
+        }
+
+        /**
+         * @brief Encode all fields at once into the start of out
+         *
+         * @return Result<std::size_t> kSize, or truncation if out is too small
+         */
+        static auto Encode(std::span<std::uint8_t> out, typename Fields::ValueType const&... values) noexcept
+            -> Result<std::size_t>
+        {
+            if(out.size() < kSize) [[unlikely]]
+                return MakeUnexpected(asrt::ErrorCodeType::truncation);
+            EncodeUnchecked(out.data(), values...);
+            return kSize;
+        }
+
+        /**
+         * @brief Encode all fields at once into an array of exactly kSize bytes
+         */
+        static constexpr auto Encode(typename Fields::ValueType const&... values) noexcept -> std::array<std::uint8_t, kSize>
+        {
+            std::array<std::uint8_t, kSize> encoded{};
+            EncodeUnchecked(encoded.data(), values...);
+            return encoded;
+        }
+
+        /**
+         * @brief Encode all fields at once, out must hold at least kSize bytes
+         */
+        static constexpr void EncodeUnchecked(std::uint8_t* out, typename Fields::ValueType const&... values) noexcept
+        {
+            [&]<std::size_t... kIndices>(std::index_sequence<kIndices...>){
+                (Fields::Traits::Store(out + kOffsets[kIndices], values), ...);
+            }(std::index_sequence_for<Fields...>{});
+        }
+
+        /**
+         * @brief Decode all fields at once, data must hold at least kSize bytes
+         */
+        static constexpr auto DecodeUnchecked(std::uint8_t const* data) noexcept -> Values
+        {
+            return [&]<std::size_t... kIndices>(std::index_sequence<kIndices...>){
+                return Values{Fields::Traits::Load(data + kOffsets[kIndices])...};
+            }(std::index_sequence_for<Fields...>{});
+        }
+
+        static constexpr std::string_view NameOf(std::size_t index) noexcept { return kNames[index]; }
+    };
+
+    /**
+     * @brief Read access to a message laid out as Layout, the message bytes are not copied
+     * @note Only valid for as long as the viewed bytes are, eg: while the frame holding them is kept
+     */
+    template <typename Layout>
+    class MessageView
+    {
+    public:
+        constexpr MessageView() noexcept = default;
+
+        /**
+         * @brief Field value in host representation, loaded from its constant offset
+         */
+        template <internal::FieldName Name>
+        constexpr auto Get() const noexcept -> typename Layout::template FieldOf<Name>::ValueType
+        {
+            return Layout::template FieldOf<Name>::Traits::Load(this->data_.data() + Layout::template OffsetOf<Name>());
+        }
+
+        /**
+         * @brief All fields at once, in declaration order
+         */
+        constexpr auto Values() const noexcept -> typename Layout::Values { return Layout::DecodeUnchecked(this->data_.data()); }
+
+        /* Bytes following the fixed fields */
+        constexpr auto Tail() const noexcept -> std::span<std::uint8_t const> { return this->data_.subspan(Layout::kSize); }
+
+        constexpr auto Data() const noexcept -> std::span<std::uint8_t const> { return this->data_; }
+
+    private:
+        friend Layout;
+        template <typename> friend class MutableMessageView;
+
+        constexpr explicit MessageView(std::span<std::uint8_t const> data) noexcept : data_{data} {}
+
+        std::span<std::uint8_t const> data_{};
+    };
+
+    /**
+     * @brief Write access to a message laid out as Layout, fields are stored straight into the viewed bytes
+     */
+    template <typename Layout>
+    class MutableMessageView
+    {
+    public:
+        constexpr MutableMessageView() noexcept = default;
+
+        template <internal::FieldName Name>
+        constexpr auto Get() const noexcept -> typename Layout::template FieldOf<Name>::ValueType
+        {
+            return Layout::template FieldOf<Name>::Traits::Load(this->data_.data() + Layout::template OffsetOf<Name>());
+        }
+
+        template <internal::FieldName Name>
+        constexpr void Set(typename Layout::template FieldOf<Name>::ValueType value) noexcept
+        {
+            Layout::template FieldOf<Name>::Traits::Store(this->data_.data() + Layout::template OffsetOf<Name>(), value);
+        }
+
+        constexpr auto Tail() const noexcept -> std::span<std::uint8_t> { return this->data_.subspan(Layout::kSize); }
+
+        constexpr auto Data() const noexcept -> std::span<std::uint8_t> { return this->data_; }
+
+        constexpr operator MessageView<Layout>() const noexcept { return MessageView<Layout>{this->data_}; }
+
+    private:
+        friend Layout;
+
+        constexpr explicit MutableMessageView(std::span<std::uint8_t> data) noexcept : data_{data} {}
+
+        std::span<std::uint8_t> data_{};
+    };
+
+} //end ns
+
+#endif /* D4A9E6C1_3B72_4F05_8C1D_92E7A5F03B68 */
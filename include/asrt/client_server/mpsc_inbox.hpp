@@ -0,0 +1,247 @@
+#ifndef C83E5A17_4F0B_4D92_A6E1_5B7D2C90F4A3
+#define C83E5A17_4F0B_4D92_A6E1_5B7D2C90F4A3
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <bit>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <immintrin.h>
+#endif
+
+namespace ClientServer
+{
+    namespace internal
+    {
+        static constexpr std::size_t kDefaultInboxCapacity{1024u};
+        static constexpr std::size_t kInboxSpinCount{4096u}; /* polls of an empty inbox before the consumer parks */
+        static constexpr std::size_t kInboxAlign{64u}; /* keeps producer and consumer positions on separate cache lines */
+        static constexpr std::size_t kProcessBatchSize{256u}; /* messages taken out of the inbox at once */
+
+        inline void CpuRelax() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            _mm_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield" ::: "memory");
+#endif
+        }
+    }
+
+    /**
+     * @brief Bounded lock-free inbox, many producers and a single consumer
+     * @details Producers claim a slot of a ring with one compare-and-swap and publish the item through the slot's
+     *  sequence number, the consumer takes items out without any atomic read-modify-write, in batches through
+     *  DrainInto(). Should the ring fill up, items spill into a locked overflow queue until the consumer caught up,
+     *  so a producer is never blocked nor an item lost, and items pushed by one producer are drained in push order.
+     *  Wait() polls the inbox for a while before parking the consumer until the next push.
+     *
+     * @tparam T item type, default constructible and move assignable
+     * @tparam MutexType lock of the overflow queue
+     * @note Push() is thread safe, all other functions must be called from the consumer thread only
+     *  with the exception of Interrupt().
+     */
+    template <typename T, typename MutexType = std::mutex>
+    class MpscInbox
+    {
+    public:
+        /**
+         * @param capacity number of ring slots, rounded up to a power of two
+         */
+        explicit MpscInbox(std::size_t capacity = internal::kDefaultInboxCapacity) noexcept
+            : mask_{std::bit_ceil(capacity < 2u ? 2u : capacity) - 1u},
+              cells_{std::make_unique<Cell[]>(mask_ + 1u)}
+        {
+            for(std::size_t i{0u}; i <= this->mask_; ++i)
+                this->cells_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+
+        MpscInbox(MpscInbox const&) = delete;
+        MpscInbox(MpscInbox&&) = delete;
+        MpscInbox &operator=(MpscInbox const &other) = delete;
+        MpscInbox &operator=(MpscInbox &&other) = delete;
+        ~MpscInbox() noexcept = default;
+
+        /**
+         * @brief Add an item, waking the consumer if it is parked
+         */
+        void Push(T item) noexcept
+        {
+            if(this->spilling_.load(std::memory_order_acquire) || !this->TryPushToRing(item)) [[unlikely]] {
+                std::scoped_lock const lock{this->overflow_mtx_};
+                this->overflow_.emplace_back(std::move(item));
+                this->spilling_.store(true, std::memory_order_release);
+            }
+            this->WakeConsumer();
+        }
+
+        /**
+         * @brief Move up to max items into out, oldest first, without blocking
+         *
+         * @param out
+         * @param max
+         * @return std::size_t number of items moved
+         */
+        std::size_t DrainInto(std::span<T> out, std::size_t max) noexcept
+        {
+            max = max < out.size() ? max : out.size();
+            std::size_t drained{0u};
+            while(drained < max && this->TryPopFromRing(out[drained]))
+                ++drained;
+
+            if(drained < max && this->spilling_.load(std::memory_order_acquire)) [[unlikely]]
+                drained += this->DrainOverflow(out.subspan(drained), max - drained);
+
+            return drained;
+        }
+
+        /**
+         * @brief Block until the inbox is not empty or Interrupt() is called, polling for a while before parking
+         *
+         * @return true if items are available, false if interrupted
+         */
+        bool Wait() noexcept
+        {
+            for(std::size_t spin{0u}; spin < internal::kInboxSpinCount; ++spin){
+                if(!this->IsEmpty()) [[likely]]
+                    return true;
+                if(this->interrupted_.exchange(false, std::memory_order_acquire)) [[unlikely]]
+                    return false;
+                internal::CpuRelax();
+            }
+
+            for(;;){
+                std::uint32_t const wakeups{this->wakeups_.load(std::memory_order_acquire)};
+                this->parked_.store(true, std::memory_order_relaxed);
+                /* pairs with the fence in WakeConsumer(), either we see the item or the producer sees us parked */
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if(!this->IsEmpty() || this->interrupted_.load(std::memory_order_relaxed)){
+                    this->parked_.store(false, std::memory_order_relaxed);
+                    return !this->interrupted_.exchange(false, std::memory_order_acquire);
+                }
+                this->wakeups_.wait(wakeups, std::memory_order_acquire);
+                this->parked_.store(false, std::memory_order_relaxed);
+                if(!this->IsEmpty()) [[likely]]
+                    return true;
+                if(this->interrupted_.exchange(false, std::memory_order_acquire))
+                    return false;
+            }
+        }
+
+        /**
+         * @brief Make the current or next Wait() return false. Thread safe.
+         */
+        void Interrupt() noexcept
+        {
+            this->interrupted_.store(true, std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            this->wakeups_.fetch_add(1u, std::memory_order_release);
+            this->wakeups_.notify_one();
+        }
+
+        bool IsEmpty() const noexcept
+        {
+            return this->dequeue_pos_ == this->enqueue_pos_.load(std::memory_order_acquire) &&
+                !this->spilling_.load(std::memory_order_acquire);
+        }
+
+        std::size_t Capacity() const noexcept { return this->mask_ + 1u; }
+
+        /**
+         * @brief Drop all items
+         */
+        void Clear() noexcept
+        {
+            T discarded;
+            while(this->DrainInto(std::span<T>{&discarded, 1u}, 1u) != 0u)
+                discarded = T{};
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<std::size_t> sequence_;
+            T item_{};
+        };
+
+        bool TryPushToRing(T& item) noexcept
+        {
+            std::size_t pos{this->enqueue_pos_.load(std::memory_order_relaxed)};
+            for(;;){
+                Cell& cell{this->cells_[pos & this->mask_]};
+                std::size_t const sequence{cell.sequence_.load(std::memory_order_acquire)};
+                auto const diff{static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos)};
+                if(diff == 0){
+                    if(this->enqueue_pos_.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)){
+                        cell.item_ = std::move(item);
+                        cell.sequence_.store(pos + 1u, std::memory_order_release);
+                        return true;
+                    }
+                }else if(diff < 0){
+                    return false; /* full */
+                }else{
+                    pos = this->enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool TryPopFromRing(T& item) noexcept
+        {
+            Cell& cell{this->cells_[this->dequeue_pos_ & this->mask_]};
+            if(cell.sequence_.load(std::memory_order_acquire) != this->dequeue_pos_ + 1u)
+                return false; /* empty, or the producer of the oldest slot has not published it yet */
+            item = std::move(cell.item_);
+            cell.item_ = T{}; /* release what the item holds on to now rather than once the slot is reused */
+            cell.sequence_.store(this->dequeue_pos_ + this->mask_ + 1u, std::memory_order_release);
+            ++this->dequeue_pos_;
+            return true;
+        }
+
+        std::size_t DrainOverflow(std::span<T> out, std::size_t max) noexcept
+        {
+            std::scoped_lock const lock{this->overflow_mtx_};
+            /* a producer spills only after its earlier items were published to the ring,
+                they must all be drained first to keep its items in order */
+            if(this->dequeue_pos_ != this->enqueue_pos_.load(std::memory_order_acquire))
+                return 0u;
+
+            std::size_t drained{0u};
+            while(drained < max && !this->overflow_.empty()){
+                out[drained++] = std::move(this->overflow_.front());
+                this->overflow_.pop_front();
+            }
+            if(this->overflow_.empty())
+                this->spilling_.store(false, std::memory_order_release);
+            return drained;
+        }
+
+        void WakeConsumer() noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(this->parked_.load(std::memory_order_relaxed)) [[unlikely]] {
+                this->wakeups_.fetch_add(1u, std::memory_order_release);
+                this->wakeups_.notify_one();
+            }
+        }
+
+        std::size_t const mask_;
+        std::unique_ptr<Cell[]> cells_;
+        alignas(internal::kInboxAlign) std::atomic<std::size_t> enqueue_pos_{0u};
+        alignas(internal::kInboxAlign) std::size_t dequeue_pos_{0u};
+        std::atomic<bool> parked_{false};
+        std::atomic<bool> interrupted_{false};
+        std::atomic<std::uint32_t> wakeups_{0u};
+        alignas(internal::kInboxAlign) std::atomic<bool> spilling_{false};
+        MutexType overflow_mtx_;
+        std::deque<T> overflow_{};
+    };
+
+} //end ns
+
+#endif /* C83E5A17_4F0B_4D92_A6E1_5B7D2C90F4A3 */
@@ -0,0 +1,77 @@
+#ifndef F2B86D3A_9E41_4C07_B5A2_6D1E8C47F390
+#define F2B86D3A_9E41_4C07_B5A2_6D1E8C47F390
+
+#include <chrono>
+#include <random>
+
+namespace ClientServer
+{
+    /**
+     * @brief Delays between attempts to reach a server
+     * @details Each failed attempt multiplies the delay by multiplier_ up to max_delay_. A share jitter_ of
+     *  every delay is drawn at random, so that connections losing the same server do not retry in lockstep.
+     *  A multiplier_ of 1 and a jitter_ of 0 retry on a fixed period.
+     */
+    struct ReconnectOptions
+    {
+        std::chrono::microseconds initial_delay_{std::chrono::milliseconds{100}};
+        std::chrono::microseconds max_delay_{std::chrono::seconds{5}};
+        double multiplier_{2.0};
+        double jitter_{0.5}; /* 0 to 1 */
+    };
+
+    namespace internal
+    {
+        /**
+         * @brief Jittered exponential backoff, see ReconnectOptions
+         * @note Not thread safe
+         */
+        class ReconnectBackoff
+        {
+        public:
+            using Duration = std::chrono::microseconds;
+
+            explicit ReconnectBackoff(ReconnectOptions options = {}) noexcept
+                : options_{options}, next_{options.initial_delay_} {}
+
+            /**
+             * @brief Delay before the next attempt, the one after is longer
+             */
+            Duration Next() noexcept
+            {
+                Duration const delay{this->next_};
+                double const grown{static_cast<double>(delay.count()) * this->options_.multiplier_};
+                this->next_ = grown < static_cast<double>(this->options_.max_delay_.count()) ?
+                    Duration{static_cast<Duration::rep>(grown)} : this->options_.max_delay_;
+
+                if(this->options_.jitter_ <= 0.0 || delay.count() == 0)
+                    return delay;
+                if(!this->seeded_) [[unlikely]] { /* on first use, most connections never retry */
+                    this->random_.seed(std::random_device{}());
+                    this->seeded_ = true;
+                }
+                std::uniform_real_distribution<double> share{0.0, this->options_.jitter_};
+                return Duration{static_cast<Duration::rep>(static_cast<double>(delay.count()) * (1.0 - share(this->random_)))};
+            }
+
+            /**
+             * @brief Start over from the initial delay, eg: once connected
+             */
+            void Reset() noexcept
+            {
+                this->next_ = this->options_.initial_delay_;
+            }
+
+            ReconnectOptions const& GetOptions() const noexcept { return this->options_; }
+
+        private:
+            ReconnectOptions options_;
+            Duration next_;
+            std::minstd_rand random_{};
+            bool seeded_{false};
+        };
+    }
+
+} //end ns
+
+#endif /* F2B86D3A_9E41_4C07_B5A2_6D1E8C47F390 */
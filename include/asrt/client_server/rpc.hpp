@@ -0,0 +1,397 @@
+#ifndef B7E3F9A2_5C14_4D6B_A0E8_3F27C9D15B84
+#define B7E3F9A2_5C14_4D6B_A0E8_3F27C9D15B84
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "asrt/config.hpp"
+#include "asrt/error_code.hpp"
+#include "asrt/inplace_function.hpp"
+#include "asrt/executor/strand.hpp"
+#include "asrt/client_server/framing.hpp"
+#include "asrt/client_server/message_schema.hpp"
+
+namespace ClientServer
+{
+    namespace internal
+    {
+        /* message types reserved for rpc, application messages use the types below */
+        static constexpr std::uint8_t kRpcRequestType{0xFEu};
+        static constexpr std::uint8_t kRpcResponseType{0xFFu};
+        /* the slot of a call takes the low bits of its correlation id, the remaining bits tell reuses of the slot apart */
+        static constexpr std::uint32_t kRpcSlotBits{16u};
+        static constexpr std::size_t kMaxCallsInFlight{std::size_t{1u} << kRpcSlotBits};
+        static constexpr std::chrono::milliseconds kDefaultRpcTimeout{5000};
+        /* period of the deadline sweep, calls time out up to twice this late */
+        static constexpr std::chrono::milliseconds kRpcDeadlineResolution{10};
+    }
+
+    enum class RpcStatus : std::uint8_t
+    {
+        kOk = 0,
+        kUnknownMethod = 1, /* the server has no handler for the method */
+        kFailed = 2         /* the handler failed, the payload may tell why */
+    };
+
+    /**
+     * @brief Body of rpc requests and responses, followed by the payload
+     */
+    using RpcHeaderLayout = MessageLayout<
+        MessageField<"correlation_id", std::uint32_t>,
+        MessageField<"method", std::uint16_t>,
+        MessageField<"status", RpcStatus>>;
+
+    /**
+     * @brief A received rpc request or response, viewed in place in the frame it was received in
+     */
+    class RpcMessage
+    {
+    public:
+        RpcMessage() noexcept = default;
+
+        /**
+         * @brief Take an rpc message out of a received frame
+         *
+         * @return Result<RpcMessage> read_insufficient_data if the frame body is shorter than the rpc header
+         */
+        static auto FromFrame(Frame frame) noexcept -> Result<RpcMessage>
+        {
+            return frame.BodyAs<RpcHeaderLayout>()
+                .map([&frame](RpcHeaderLayout::View header){
+                    return RpcMessage{std::move(frame), header};
+                });
+        }
+
+        std::uint32_t CorrelationId() const noexcept { return this->header_.Get<"correlation_id">(); }
+
+        std::uint16_t Method() const noexcept { return this->header_.Get<"method">(); }
+
+        RpcStatus Status() const noexcept { return this->header_.Get<"status">(); }
+
+        Frame::ConstView Payload() const noexcept { return this->header_.Tail(); }
+
+        /* The frame holding the message, eg: to keep the payload beyond the handler */
+        Frame const& GetFrame() const noexcept { return this->frame_; }
+
+    private:
+        RpcMessage(Frame&& frame, RpcHeaderLayout::View header) noexcept
+            : frame_{std::move(frame)}, header_{header} {}
+
+        Frame frame_{};
+        RpcHeaderLayout::View header_{};
+    };
+
+    using RpcRequest = RpcMessage;
+    using RpcReply = RpcMessage;
+
+    /**
+     * @brief Completion of a call: the reply, or timed_out, capacity_exceeded, operation_aborted
+     *  or the error the connection failed with
+     */
+    using RpcHandler = asrt::InplaceFunction<void(Result<RpcReply>), asrt::config::kRpcHandlerCapacity>;
+
+    template <typename Executor>
+    struct RpcCallOptions
+    {
+        using Duration = std::chrono::nanoseconds;
+
+        /* the call fails with timed_out if no reply arrived within, zero waits forever */
+        Duration timeout_{internal::kDefaultRpcTimeout};
+        /* runs the handler if set, otherwise it runs on the thread completing the call */
+        ExecutorNS::Strand<Executor>* strand_{nullptr};
+    };
+
+    /**
+     * @brief Calls of one client awaiting their reply, keyed by correlation id
+     * @details Calls live in slots reused through a free list, the correlation id of a call locates its slot
+     *  directly, so issuing and completing a call neither searches nor allocates once the table has grown to
+     *  the number of calls in flight. Deadlines are kept in a heap indexed by slot, a call completing in time
+     *  is taken out of the heap right away. Calls time out by a single periodic sweep on the executor's timer
+     *  service which only runs while calls are in flight, rather than by a timer per call.
+     *
+     * @tparam Executor runs the deadline sweep
+     * @note Thread safe. Handlers are invoked without any lock held, and may issue calls.
+     * @warning Must not be destroyed while a sweep is being executed, ie: stop the executor first
+     */
+    template <typename Executor>
+    class RpcCallTable
+    {
+    public:
+        using Clock         = std::chrono::steady_clock;
+        using Options       = RpcCallOptions<Executor>;
+        using Strand        = ExecutorNS::Strand<Executor>;
+        using CorrelationId = std::uint32_t;
+
+        explicit RpcCallTable(Executor& executor, std::size_t max_in_flight = internal::kMaxCallsInFlight) noexcept
+            : executor_{executor},
+              max_in_flight_{max_in_flight < internal::kMaxCallsInFlight ? max_in_flight : internal::kMaxCallsInFlight} {}
+
+        RpcCallTable(RpcCallTable const&) = delete;
+        RpcCallTable(RpcCallTable&&) = delete;
+        RpcCallTable &operator=(RpcCallTable const &other) = delete;
+        RpcCallTable &operator=(RpcCallTable &&other) = delete;
+
+        ~RpcCallTable() noexcept
+        {
+            std::scoped_lock const lock{this->mtx_};
+            this->StopSweep();
+        }
+
+        /**
+         * @brief Register a call about to be sent
+         *
+         * @return Result<CorrelationId> to be sent along with the request,
+         *  or capacity_exceeded if too many calls are in flight
+         */
+        auto Add(RpcHandler&& handler, Options const& options) noexcept -> Result<CorrelationId>
+        {
+            std::scoped_lock const lock{this->mtx_};
+
+            std::uint32_t slot;
+            if(!this->free_slots_.empty()) [[likely]] {
+                slot = this->free_slots_.back();
+                this->free_slots_.pop_back();
+            }else if(this->calls_.size() < this->max_in_flight_){
+                slot = static_cast<std::uint32_t>(this->calls_.size());
+                this->calls_.emplace_back();
+            }else [[unlikely]] {
+                return MakeUnexpected(asrt::ErrorCodeType::capacity_exceeded);
+            }
+
+            Call& call{this->calls_[slot]};
+            call.id_ = ((call.id_ >> internal::kRpcSlotBits) + 1u) << internal::kRpcSlotBits | slot; /* next generation */
+            call.handler_ = std::move(handler);
+            call.strand_ = options.strand_;
+            call.active_ = true;
+            ++this->in_flight_;
+
+            if(options.timeout_.count() > 0){
+                call.deadline_ = Clock::now() + options.timeout_;
+                this->HeapPush(slot);
+                if(this->sweep_task_ == Executor::kInvalidPeriodicTaskId) [[unlikely]]
+                    this->StartSweep();
+            }
+            return call.id_;
+        }
+
+        /**
+         * @brief Drop a call without invoking its handler, eg: because its request could not be sent
+         */
+        void Cancel(CorrelationId id) noexcept
+        {
+            RpcHandler discarded;
+            std::scoped_lock const lock{this->mtx_};
+            if(Call* call{this->Find(id)}; call != nullptr)
+                discarded = this->Release(*call).handler_;
+        }
+
+        /**
+         * @brief Complete the call the reply belongs to, replies to calls that timed out are dropped
+         */
+        void Complete(RpcReply&& reply) noexcept
+        {
+            Completion completion;
+            {
+                std::scoped_lock const lock{this->mtx_};
+                Call* call{this->Find(reply.CorrelationId())};
+                if(call == nullptr) [[unlikely]] {
+                    ASRT_LOG_DEBUG("[RPC]: Dropping reply to call {:#x}, not in flight", reply.CorrelationId());
+                    return;
+                }
+                completion = this->Release(*call);
+            }
+            Finish(std::move(completion), std::move(reply));
+        }
+
+        /**
+         * @brief Fail all calls in flight, eg: once the connection they were sent on is lost
+         */
+        void FailAll(asrt::ErrorCodeType ec) noexcept
+        {
+            std::vector<Completion> failed;
+            {
+                std::scoped_lock const lock{this->mtx_};
+                failed.reserve(this->in_flight_);
+                for(Call& call : this->calls_)
+                    if(call.active_) failed.emplace_back(this->Release(call));
+            }
+            for(Completion& completion : failed)
+                Finish(std::move(completion), MakeUnexpected(ec));
+        }
+
+        std::size_t InFlight() const noexcept
+        {
+            std::scoped_lock const lock{this->mtx_};
+            return this->in_flight_;
+        }
+
+    private:
+        using MutexType = typename Executor::MutexType;
+        using PeriodicTaskId = typename Executor::PeriodicTaskId;
+
+        static constexpr std::uint32_t kNotQueued{~std::uint32_t{0u}};
+        static constexpr CorrelationId kSlotMask{(CorrelationId{1u} << internal::kRpcSlotBits) - 1u};
+
+        struct Call
+        {
+            CorrelationId id_{0u};
+            bool active_{false};
+            std::uint32_t heap_index_{kNotQueued};
+            Clock::time_point deadline_{};
+            Strand* strand_{nullptr};
+            RpcHandler handler_{};
+        };
+
+        struct Completion
+        {
+            RpcHandler handler_{};
+            Strand* strand_{nullptr};
+        };
+
+        static void Finish(Completion&& completion, Result<RpcReply>&& result) noexcept
+        {
+            if(completion.strand_ != nullptr){
+                completion.strand_->Post(
+                    [handler = std::move(completion.handler_), result = std::move(result)]() mutable {
+                        handler(std::move(result));
+                    });
+            }else{
+                completion.handler_(std::move(result));
+            }
+        }
+
+        Call* Find(CorrelationId id) noexcept
+        {
+            std::size_t const slot{id & kSlotMask};
+            if(slot >= this->calls_.size()) [[unlikely]] return nullptr;
+            Call& call{this->calls_[slot]};
+            return (call.active_ && call.id_ == id) ? &call : nullptr;
+        }
+
+        Completion Release(Call& call) noexcept
+        {
+            if(call.heap_index_ != kNotQueued)
+                this->HeapErase(call.heap_index_);
+            call.active_ = false;
+            --this->in_flight_;
+            this->free_slots_.push_back(call.id_ & kSlotMask);
+            return Completion{std::move(call.handler_), std::exchange(call.strand_, nullptr)};
+        }
+
+        /**
+         * @brief Time out all calls past their deadline, stop sweeping once no call is in flight
+         */
+        void Sweep() noexcept
+        {
+            std::vector<Completion> expired;
+            {
+                std::scoped_lock const lock{this->mtx_};
+                Clock::time_point const now{Clock::now()};
+                while(!this->deadlines_.empty() && this->calls_[this->deadlines_.front()].deadline_ <= now)
+                    expired.emplace_back(this->Release(this->calls_[this->deadlines_.front()]));
+                if(this->deadlines_.empty())
+                    this->StopSweep();
+            }
+            for(Completion& completion : expired)
+                Finish(std::move(completion), MakeUnexpected(asrt::ErrorCodeType::timed_out));
+        }
+
+        void StartSweep() noexcept
+        {
+            /* assumes lock held */
+            this->executor_.PostPeriodic(internal::kRpcDeadlineResolution, [this](){ this->Sweep(); },
+                    Executor::PeriodicExecutionMode::kDeferred, internal::kRpcDeadlineResolution)
+                .map([this](PeriodicTaskId task){ this->sweep_task_ = task; })
+                .map_error([](asrt::ErrorCodeType ec){
+                    ASRT_LOG_ERROR("[RPC]: Unable to schedule deadline sweep, calls will not time out: {}", ec);
+                    return ec;
+                });
+        }
+
+        void StopSweep() noexcept
+        {
+            /* assumes lock held */
+            if(this->sweep_task_ == Executor::kInvalidPeriodicTaskId)
+                return;
+            static_cast<void>(this->executor_.CancelTimedJob(this->sweep_task_));
+            this->sweep_task_ = Executor::kInvalidPeriodicTaskId;
+        }
+
+        /* binary min-heap of slots ordered by deadline, each call knows its position */
+
+        bool Earlier(std::uint32_t lhs, std::uint32_t rhs) const noexcept
+        {
+            return this->calls_[this->deadlines_[lhs]].deadline_ < this->calls_[this->deadlines_[rhs]].deadline_;
+        }
+
+        void HeapSwap(std::uint32_t lhs, std::uint32_t rhs) noexcept
+        {
+            std::swap(this->deadlines_[lhs], this->deadlines_[rhs]);
+            this->calls_[this->deadlines_[lhs]].heap_index_ = lhs;
+            this->calls_[this->deadlines_[rhs]].heap_index_ = rhs;
+        }
+
+        void SiftUp(std::uint32_t index) noexcept
+        {
+            while(index > 0u){
+                std::uint32_t const parent{(index - 1u) / 2u};
+                if(!this->Earlier(index, parent)) break;
+                this->HeapSwap(index, parent);
+                index = parent;
+            }
+        }
+
+        void SiftDown(std::uint32_t index) noexcept
+        {
+            auto const size{static_cast<std::uint32_t>(this->deadlines_.size())};
+            for(;;){
+                std::uint32_t earliest{index};
+                std::uint32_t const left{2u * index + 1u};
+                if(left < size && this->Earlier(left, earliest)) earliest = left;
+                if(left + 1u < size && this->Earlier(left + 1u, earliest)) earliest = left + 1u;
+                if(earliest == index) break;
+                this->HeapSwap(index, earliest);
+                index = earliest;
+            }
+        }
+
+        void HeapPush(std::uint32_t slot) noexcept
+        {
+            auto const index{static_cast<std::uint32_t>(this->deadlines_.size())};
+            this->deadlines_.push_back(slot);
+            this->calls_[slot].heap_index_ = index;
+            this->SiftUp(index);
+        }
+
+        void HeapErase(std::uint32_t index) noexcept
+        {
+            auto const last{static_cast<std::uint32_t>(this->deadlines_.size() - 1u)};
+            this->calls_[this->deadlines_[index]].heap_index_ = kNotQueued;
+            if(index != last){
+                this->deadlines_[index] = this->deadlines_[last];
+                this->calls_[this->deadlines_[index]].heap_index_ = index;
+            }
+            this->deadlines_.pop_back();
+            if(index < this->deadlines_.size()){
+                this->SiftUp(index);
+                this->SiftDown(this->calls_[this->deadlines_[index]].heap_index_);
+            }
+        }
+
+        Executor& executor_;
+        std::size_t const max_in_flight_;
+        mutable MutexType mtx_;
+        std::vector<Call> calls_{};
+        std::vector<std::uint32_t> free_slots_{};
+        std::vector<std::uint32_t> deadlines_{}; /* slots of the calls with a deadline */
+        std::size_t in_flight_{0u};
+        PeriodicTaskId sweep_task_{Executor::kInvalidPeriodicTaskId};
+    };
+
+} //end ns
+
+#endif /* B7E3F9A2_5C14_4D6B_A0E8_3F27C9D15B84 */
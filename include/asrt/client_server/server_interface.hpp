@@ -1,6 +1,8 @@
 #ifndef DAFF1A70_A3D3_47D1_8C77_5FE546E42051
 #define DAFF1A70_A3D3_47D1_8C77_5FE546E42051
 
+#include <cstring>
+#include <deque>
 #include <memory>
 #include <vector>
 #include <algorithm>
@@ -9,8 +11,12 @@
 #include "asrt/util.hpp"
 #include "asrt/error_code.hpp"
 #include "asrt/client_server/common_types.hpp"
-#include "asrt/client_server/message_queue.hpp"
+#include "asrt/client_server/mpsc_inbox.hpp"
 #include "asrt/client_server/connection.hpp"
+#include "asrt/client_server/broadcast.hpp"
+#include "asrt/client_server/connection_pool.hpp"
+#include "asrt/client_server/connection_registry.hpp"
+#include "asrt/client_server/rpc.hpp"
 
 namespace ClientServer{
 
@@ -28,6 +34,8 @@ public:
     using Inbox                 = typename ConnectionToClient::Inbox;
     using ClientId              = typename ConnectionToClient::ConnectionIdType;
     using ConstMessageView      = typename ConnectionToClient::ConstMessageView;
+    using WriteOptions          = typename ConnectionToClient::WriteOptions;
+    using RpcRequest            = ClientServer::RpcRequest;
 
     explicit ServerInterface(const Endpoint& endpoint, 
                              ProcessingMode mode = ProcessingMode::kEvent) noexcept;
@@ -59,7 +67,81 @@ public:
 
     void MessageAllClients(ConstMessageView message) noexcept;
 
-    void Process(std::size_t max_messages) noexcept;
+    /**
+     * @brief Queue a message to all connected clients without waiting for it to be sent, encoding it only once
+     * @details The message is copied once into a pooled buffer which is queued to every recipient by reference. 
+     *  The recipients are split into jobs that run concurrently on the executor threads, so a slow recipient 
+     *  delays neither the others nor the caller. Recipients whose outgoing message queue reached its high watermark 
+     *  are handled by the broadcast policy. Broadcasts reach each recipient in the order they were issued, a broadcast 
+     *  starts fanning out once the previous one has been queued to all its recipients. Unlike MessageAllClients(), 
+     *  the message is not necessarily queued before messages sent to the same client after this call returns.
+     * 
+     * @param message copied, may be released once the function returns
+     * @param options 
+     * @param handler invoked in executor context once the message has been queued to all recipients
+     * @return Result<void> no_memory if the message could not be buffered
+     */
+    auto BroadcastAsync(ConstMessageView message, BroadcastOptions options = {}, 
+        BroadcastHandler handler = {}) noexcept -> Result<void>;
+
+    /**
+     * @brief Like BroadcastAsync(ConstMessageView, ...), for a message already encoded into a pooled buffer
+     * 
+     * @param message queued by reference, must not be modified until the handler is invoked
+     */
+    void BroadcastAsync(Buffer::PooledBuffer message, BroadcastOptions options = {}, 
+        BroadcastHandler handler = {}) noexcept;
+
+    /**
+     * @brief Answer an rpc request, from any thread and at any time after it was received
+     * @details Requests of a client may be answered in any order, the client matches the response to its call 
+     *  by the correlation id of the request.
+     * 
+     * @param client the client the request was received from
+     * @param request 
+     * @param payload copied, may be released once the function returns
+     * @param status 
+     * @return Result<void> see Connection::WriteFrame()
+     */
+    auto Respond(Client const& client, RpcRequest const& request, ConstMessageView payload, 
+        RpcStatus status = RpcStatus::kOk) noexcept -> Result<void>;
+
+    /**
+     * @brief Bound the outgoing message queue of client connections accepted from now on
+     * @details A client that does not keep up with its messages is handled by the overflow policy once 
+     *  its queue exceeds the high watermark: its oldest queued messages are dropped, the caller is blocked 
+     *  or the client is disconnected (default).
+     * 
+     * @param options 
+     */
+    void SetClientWriteOptions(WriteOptions options) noexcept;
+
+    /**
+     * @brief Keep up to count client connections for reuse once their client is gone, constructing them ahead of time
+     * @details Accepting a client then takes a pooled connection instead of constructing one, and its socket joins the 
+     *  reactor slot retained from the previous client instead of registering anew, which suits many short-lived clients.
+     *  Each pooled connection holds on to a reactor slot. Pooling is disabled by default.
+     * 
+     * @param count 
+     */
+    void ReserveClientConnections(std::size_t count) noexcept;
+
+    /**
+     * @brief Handle up to max_messages queued messages in polling mode, without blocking
+     * @details Messages are taken out of the lock-free inbox in batches, OnMessage() is called for each of them 
+     *  on the calling thread. Call from one thread at a time.
+     * 
+     * @param max_messages 
+     * @return std::size_t number of messages handled
+     */
+    std::size_t Process(std::size_t max_messages) noexcept;
+
+    /**
+     * @brief Block until messages are queued in polling mode, spinning for a while before parking the calling thread
+     * 
+     * @return true if messages are queued, false if woken up by Stop()
+     */
+    bool WaitForMessages() noexcept;
 
     auto RetrieveInbox() noexcept -> Inbox*;
 
@@ -93,32 +175,72 @@ public:
 
     virtual void OnMessage(Client client, ConstMessageView message) noexcept {}
 
+    /**
+     * @brief Customization point for server implementation to handle rpc requests, answered through Respond()
+     * @details Called in the same context as OnMessage(). Requests of a client are handed over in the order 
+     *  they were sent, the client keeps sending further requests meanwhile. By default every method is unknown.
+     * 
+     * @param client 
+     * @param request views the received data, which stays valid as long as request or a copy of it is kept
+     */
+    virtual void OnRequest(Client client, RpcRequest request) noexcept
+    {
+        static_cast<void>(this->Respond(client, request, {}, RpcStatus::kUnknownMethod));
+    }
+
+    /**
+     * @brief Called by the connection on receiving an rpc request frame
+     */
+    void OnRpcRequest(Client client, Frame&& frame) noexcept;
+
+    /**
+     * @brief Customization point for server implementation to resume messaging a client 
+     *  whose outgoing message queue drained to its low watermark after reaching its high watermark
+     * 
+     * @param client shared pointer to this connection
+     */
+    virtual void OnClientWritable(Client& client) noexcept {}
+
 protected:
 
     auto& GetExecutor() noexcept{return this->executor_;}
 
 private:
     using ConnectionId = typename ConnectionToClient::ConnectionIdType;
+    template <typename T> using Optional = Util::Optional_NS::Optional<T>;
 
-    auto GetClientPositionInQueue(ClientId client_id) noexcept;
+    using MutexType = typename Executor::MutexType;
+    using IncomingMessage = typename ConnectionToClient::IncomingMessage;
+    using ActiveConnections = ConnectionRegistry<ConnectionToClient, MutexType>;
+    using BroadcastState = internal::BroadcastState<typename ActiveConnections::Snapshot>;
 
     void DoMessageClient(Client& client, ConstMessageView message) noexcept;
 
+    void StartBroadcast(std::shared_ptr<BroadcastState> broadcast) noexcept;
+
+    void BroadcastToRange(BroadcastState& broadcast, std::size_t first, std::size_t last) noexcept;
+
+    void OnBroadcastDone(BroadcastState& broadcast) noexcept;
+
     void WaitForClientConnections() noexcept;
 
-    void RemoveConnection(ConnectionId conn_id) noexcept;
+    void OnClientAccepted(asrt::NativeHandle handle) noexcept;
 
-    using ActiveConnections = std::vector<Client>;
-    template <typename T> using Optional = Util::Optional_NS::Optional<T>;
+    void RemoveConnection(ConnectionId conn_id) noexcept;
 
-    using MutexType = typename Executor::MutexType;
+    void ScheduleRemoveConnection(ConnectionId conn_id) noexcept;
 
     Executor executor_;
     Acceptor acceptor_;
     Optional<Inbox> inbox_{};
-    MutexType connection_storage_mutex_;
+    std::vector<IncomingMessage> drained_messages_{}; /* batch taken out of inbox_ by Process() */
+    ConnectionPool<ConnectionToClient> connection_pool_{}; /* outlives connections_ */
     ActiveConnections connections_;
+    MutexType broadcast_mutex_;
+    std::deque<std::shared_ptr<BroadcastState>> queued_broadcasts_{}; /* issued while another one fans out */
+    bool broadcast_in_progress_{false};
     std::size_t next_client_id_{0};
+    WriteOptions client_write_options_{};
 };
 
 }
@@ -2,6 +2,7 @@
 #define DA339FF9_EEAD_4A75_A747_044428B06382
 
 #include <cstdint>
+#include <cstddef>
 #include <limits>
 #include <mutex>
 //#include "asrt/reactor/epoll_reactor.hpp"
@@ -157,6 +158,14 @@ namespace config{
     static constexpr std::uint8_t kMaxTimerQueueSize{std::numeric_limits<std::uint8_t>::max()};
     static constexpr std::uint8_t kMaxReactorHandlerCount{std::numeric_limits<std::uint8_t>::max()};
 
+    /* callables up to this size are stored inside the object that holds them, ie: without allocation */
+    static constexpr std::size_t kTimerHandlerCapacity{48u};
+    static constexpr std::size_t kExecutorOperationCapacity{48u};
+    static constexpr std::size_t kRpcHandlerCapacity{48u};
+
+    /* minimum free space a dynamic buffer offers to each receive of a framed read operation */
+    static constexpr std::size_t kMinReceiveChunkSize{4096u};
+
 }
 }
 
@@ -0,0 +1,148 @@
+#ifndef C98605EB_099D_4034_8D65_1842E91CC49A
+#define C98605EB_099D_4034_8D65_1842E91CC49A
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
+namespace asrt{
+namespace details{
+
+    inline constexpr std::size_t kNoMatch = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Check the candidate positions flagged in mask for a full match of needle
+     * @details Bit k of mask is set when haystack[k] and haystack[k + n - 1] match the first
+     *  and last byte of the needle, so only the bytes in between remain to be compared.
+     */
+    template <typename Mask>
+    [[nodiscard]] inline auto
+    VerifyCandidates(Mask mask, std::uint8_t const* haystack, std::uint8_t const* needle, std::size_t n) noexcept -> std::size_t
+    {
+        while(mask != 0){
+            std::size_t const offset{static_cast<std::size_t>(std::countr_zero(mask))};
+            if(std::memcmp(haystack + offset + 1, needle + 1, n - 2) == 0)
+                return offset;
+            mask &= mask - 1; /* clear lowest candidate */
+        }
+        return kNoMatch;
+    }
+
+    /**
+     * @brief Find the first occurrence of a byte string in a buffer
+     * @details Single byte needles go to memchr (which libc already vectorizes). Longer needles
+     *  compare the first and the last needle byte against a whole block of candidate positions
+     *  at once (32 with AVX2, 16 with SSE2) and fully compare only positions passing both tests,
+     *  which keeps false positives rare even for needles such as "\r\n". Targets without SSE2
+     *  visit the positions matching the first byte via memchr.
+     *
+     * @return std::size_t offset of the needle in haystack, kNoMatch if not found
+     */
+    [[nodiscard]] inline auto
+    FindBytes(std::uint8_t const* haystack, std::size_t size, std::uint8_t const* needle, std::size_t n) noexcept -> std::size_t
+    {
+        if(n == 0) return 0;
+        if(n > size) return kNoMatch;
+        if(n == 1){
+            void const* match{std::memchr(haystack, needle[0], size)};
+            return match == nullptr ? kNoMatch :
+                static_cast<std::size_t>(static_cast<std::uint8_t const*>(match) - haystack);
+        }
+
+        std::size_t const candidates{size - n + 1}; /* number of positions the needle could start at */
+        std::size_t pos{0};
+
+#if defined(__AVX2__)
+        {
+            __m256i const first{_mm256_set1_epi8(static_cast<char>(needle[0]))};
+            __m256i const last{_mm256_set1_epi8(static_cast<char>(needle[n - 1]))};
+            for(; pos + 32 <= candidates; pos += 32){
+                __m256i const block_first{_mm256_loadu_si256(reinterpret_cast<__m256i const*>(haystack + pos))};
+                __m256i const block_last{_mm256_loadu_si256(reinterpret_cast<__m256i const*>(haystack + pos + n - 1))};
+                auto const mask{static_cast<std::uint32_t>(_mm256_movemask_epi8(
+                    _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last))))};
+                if(mask != 0){
+                    std::size_t const offset{VerifyCandidates(mask, haystack + pos, needle, n)};
+                    if(offset != kNoMatch) return pos + offset;
+                }
+            }
+        }
+#endif
+
+#if defined(__SSE2__)
+        {
+            __m128i const first{_mm_set1_epi8(static_cast<char>(needle[0]))};
+            __m128i const last{_mm_set1_epi8(static_cast<char>(needle[n - 1]))};
+            for(; pos + 16 <= candidates; pos += 16){
+                __m128i const block_first{_mm_loadu_si128(reinterpret_cast<__m128i const*>(haystack + pos))};
+                __m128i const block_last{_mm_loadu_si128(reinterpret_cast<__m128i const*>(haystack + pos + n - 1))};
+                auto const mask{static_cast<std::uint32_t>(_mm_movemask_epi8(
+                    _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))))};
+                if(mask != 0){
+                    std::size_t const offset{VerifyCandidates(mask, haystack + pos, needle, n)};
+                    if(offset != kNoMatch) return pos + offset;
+                }
+            }
+        }
+#endif
+
+        /* remaining positions, or all of them without SIMD support: let memchr skip to the candidates */
+        while(pos < candidates){
+            void const* match{std::memchr(haystack + pos, needle[0], candidates - pos)};
+            if(match == nullptr) break;
+            pos = static_cast<std::size_t>(static_cast<std::uint8_t const*>(match) - haystack);
+            if(haystack[pos + n - 1] == needle[n - 1] &&
+                std::memcmp(haystack + pos + 1, needle + 1, n - 2) == 0)
+                return pos;
+            ++pos;
+        }
+        return kNoMatch;
+    }
+
+    /**
+     * @brief Load an unaligned big endian (network byte order) unsigned integer
+     * @details Compiles to a single load plus byte swap instruction on little endian targets
+     */
+    template <typename UInt>
+        requires std::is_unsigned_v<UInt>
+    [[nodiscard]] inline auto
+    LoadBigEndian(std::uint8_t const* data) noexcept -> UInt
+    {
+        UInt value;
+        std::memcpy(&value, data, sizeof(UInt));
+        if constexpr (std::endian::native == std::endian::little && sizeof(UInt) > 1) {
+            if constexpr (sizeof(UInt) == 2) value = static_cast<UInt>(__builtin_bswap16(value));
+            else if constexpr (sizeof(UInt) == 4) value = static_cast<UInt>(__builtin_bswap32(value));
+            else if constexpr (sizeof(UInt) == 8) value = static_cast<UInt>(__builtin_bswap64(value));
+            else static_assert(sizeof(UInt) <= 8, "Unsupported integer width");
+        }
+        return value;
+    }
+
+    /**
+     * @brief Store an unsigned integer in big endian (network byte order) at an unaligned address
+     */
+    template <typename UInt>
+        requires std::is_unsigned_v<UInt>
+    inline void
+    StoreBigEndian(std::uint8_t* data, UInt value) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little && sizeof(UInt) > 1) {
+            if constexpr (sizeof(UInt) == 2) value = static_cast<UInt>(__builtin_bswap16(value));
+            else if constexpr (sizeof(UInt) == 4) value = static_cast<UInt>(__builtin_bswap32(value));
+            else if constexpr (sizeof(UInt) == 8) value = static_cast<UInt>(__builtin_bswap64(value));
+            else static_assert(sizeof(UInt) <= 8, "Unsupported integer width");
+        }
+        std::memcpy(data, &value, sizeof(UInt));
+    }
+
+} //end ns details
+} //end ns asrt
+
+#endif /* C98605EB_099D_4034_8D65_1842E91CC49A */
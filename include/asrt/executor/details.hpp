@@ -2,9 +2,11 @@
 #define DB643653_3AAA_418B_83D9_561D0B54A6D7
 
 #include <cstdint>
-#include <deque>
 
+#include "asrt/config.hpp"
 #include "asrt/common_types.hpp"
+#include "asrt/inplace_function.hpp"
+#include "asrt/ring_queue.hpp"
 #include "asrt/util.hpp"
 #include "asrt/error_code.hpp"
 #include "asrt/reactor/types.hpp"
@@ -14,8 +16,8 @@
 namespace ExecutorNS{
 
 
-using ExecutorOperation = asrt::UniqueFunction<void()>;
-using OperationQueue = std::deque<ExecutorOperation>;
+using ExecutorOperation = asrt::InplaceFunction<void(), asrt::config::kExecutorOperationCapacity>;
+using OperationQueue = asrt::RingQueue<ExecutorOperation>; /* keeps its storage, ie: does not allocate once warmed up */
 
 using namespace Util::Expected_NS;
 using ErrorCode = ErrorCode_Ns::ErrorCode;
@@ -28,10 +30,14 @@ using ReactorUnblockReason = Types::UnblockReason;
 
 static constexpr std::uint16_t kReactorHandlerCount{16u};
 static constexpr std::uint16_t kConcurrentTimerCountHint{16u};
+static constexpr std::uint8_t kMaxTimerShards{8u};
+
+using TimerShardId = std::uint8_t;
 
 struct ThreadInfo{
-    std::deque<ExecutorOperation> private_op_queue_;
+    OperationQueue private_op_queue_;
     std::uint32_t private_job_count_{0};
+    TimerShardId timer_shard_{0}; /* timer queue shard serving timers armed from this thread */
 };
 
 enum class JobContext{ kClient, kExecutor };
@@ -79,9 +79,9 @@ public:
     return Implementation().Reserve(std::move(handler));
   }
 
-  auto AddTimer(TimerTag timer, Expiry expiry, Duration interval) -> Result<void>
+  auto AddTimer(TimerTag timer, Expiry expiry, Duration interval, Duration slack = Duration{}) -> Result<void>
   {
-    return Implementation().Enqueue(timer, expiry, interval);
+    return Implementation().Enqueue(timer, expiry, interval, slack);
   }
 
   auto RemoveTimer(TimerTag timer)
@@ -89,6 +89,16 @@ public:
     return Implementation().Dequeue(timer);
   }
 
+  auto SetCatchUpPolicy(TimerTag timer, Timer::Types::CatchUpPolicy policy)
+  {
+    return Implementation().SetCatchUpPolicy(timer, policy);
+  }
+
+  auto GetTimerStatistics(TimerTag timer)
+  {
+    return Implementation().GetTimerStatistics(timer);
+  }
+
 private:
   constexpr TimerQueue& Implementation() { return static_cast<TimerQueue &>(*this); }
 };
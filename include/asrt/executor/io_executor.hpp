@@ -8,9 +8,12 @@
 #include <atomic>
 #include <iostream>
 #include <memory>
+#include <array>
+#include <algorithm>
 
 #include "asrt/config.hpp"
 #include "asrt/util.hpp"
+#include "asrt/netbuffer.hpp"
 #include "asrt/error_code.hpp"
 #include "asrt/type_traits.hpp"
 #include "asrt/executor/types.hpp"
@@ -39,8 +42,17 @@ public:
     using Self              = IO_Executor<Reactor>;
     using ReactorType       = Reactor;
     using TimerManager      = Timer::TimerQueue<Reactor>;
-    using PeriodicTaskId    = Timer::Types::TimerTag;
-    static constexpr PeriodicTaskId kInvalidPeriodicTaskId{Timer::Types::kInvalidTimerTag};
+    using TimerShardId      = ExecutorNS::TimerShardId;
+
+    /**
+     * @brief Identifies a timed task by the timer queue shard it lives in and its timer tag
+     */
+    struct PeriodicTaskId{
+        TimerShardId shard_;
+        Timer::Types::TimerTag tag_;
+        constexpr bool operator==(PeriodicTaskId const&) const noexcept = default;
+    };
+    static constexpr PeriodicTaskId kInvalidPeriodicTaskId{0u, Timer::Types::kInvalidTimerTag};
 
     using ScheduledJobId = ReactorNS::Types::HandlerTag;
     using Clock = Timer::Types::SteadyClock;
@@ -100,6 +112,16 @@ public:
         this->DoInvokeOrEnqueueOnJobArrival(std::forward<Executable>(op));
     }
 
+    /**
+     * @brief Queue a batch of operations for later execution
+     * @details The whole batch is handed over to the shared queue under a single lock 
+     *  and idle worker threads are woken so that the operations may run concurrently. 
+     *  Operations are moved out of @p ops, which is left empty.
+     * 
+     * @param ops the operations to be executed. Must NOT contain empty operations.
+     */
+    void PostBatch(OperationQueue& ops) noexcept;
+
     //todo implement defer()
 
     /**
@@ -161,13 +183,18 @@ public:
      * @param periodic_op the periodic operation to be executed. Must NOT be an empty operation or a nullptr.
      * @param period specifies the period of the periodic task
      * @param mode kDeferred: start execution at next period; kImmediate: execute as soon as possible
+     * @param slack how late each execution may be so that it can share a wakeup with other timed tasks
+     * @param catch_up what to do about periods that elapse before the task could be run for them. 
+     *  Executions are scheduled on absolute deadlines (start + n * period) and do not drift regardless.
      * 
      * @return PeriodicTaskId: a unique id assigned to the periodic task. Can be used to cancel the task later.
      *          The task id is considered valid until the task is cancelled.
      */
     template <typename Executable, typename Duration>
     auto PostPeriodic(Duration period, Executable&& periodic_op,
-        PeriodicExecutionMode mode = PeriodicExecutionMode::kDeferred) noexcept -> Result<PeriodicTaskId>
+        PeriodicExecutionMode mode = PeriodicExecutionMode::kDeferred,
+        Timer::Types::Duration slack = Timer::Types::Duration{},
+        Timer::Types::CatchUpPolicy catch_up = Timer::Types::CatchUpPolicy::kSkip) noexcept -> Result<PeriodicTaskId>
     {
         ASRT_LOG_TRACE("Posting periodic job");
         (void)this->UseTimerService(); /* enable timer services if not already enabled */
@@ -184,17 +211,29 @@ public:
 
         /* returns a job id on success */
         return this->StartTimedTaskAsync(
-            std::forward<Executable>(periodic_op), period, TimedTaskType::kRecurring);   
+            std::forward<Executable>(periodic_op), period, TimedTaskType::kRecurring, slack, catch_up);   
     }
 
     /**
      * @brief Cancels pending periodic tasks. Tasks already queued for execution are not affected.
+     * @details Cancelling from a thread of another timer shard than the one the task lives in 
+     *  only hands the cancellation over to that shard. The task is removed asynchronously, 
+     *  before the shard expires any timer again, and no completion is signalled. 
+     *  Until then invocations that shard has already dispatched may still run.
      * 
      * @param task The unique task id associated with the task. Task id is no longer valid post cancellation.
      * @return Expected<void, ErrorCode> 
      */
     auto CancelTimedJob(PeriodicTaskId task) noexcept -> Result<void>;
 
+    /**
+     * @brief Retrieve missed deadline and lateness counters of a timed task
+     * 
+     * @param task The unique task id associated with the task.
+     * @return Result<Timer::Types::TimerStatistics> 
+     */
+    auto GetTimedJobStatistics(PeriodicTaskId task) noexcept -> Result<Timer::Types::TimerStatistics>;
+
     /**
      * @brief Queue an operation for delayed execution.
      * 
@@ -246,12 +285,61 @@ public:
     auto UseReactorService() noexcept -> Reactor&; 
 
     /**
-     * @brief Returns a reference to the timer manager maintained by this executor
+     * @brief Returns a reference to the timer queue shard serving the calling thread
+     * @details Threads inside Run() are assigned a shard each (up to concurrency hint many shards). 
+     *  All other threads share shard 0.
      * 
      * @return TimerManager& 
      */
     auto UseTimerService() noexcept -> TimerManager&;
 
+    /**
+     * @brief Returns a reference to the given timer queue shard, constructing it on first use
+     * 
+     * @param shard must be less than TimerShardCount()
+     * @return TimerManager& 
+     */
+    auto UseTimerService(TimerShardId shard) noexcept -> TimerManager&;
+
+    /**
+     * @brief Called by i/o objects and users to obtain the buffer pool managed by this executor
+     * 
+     * @return Buffer::BufferPool& 
+     */
+    auto UseBufferPool() noexcept -> Buffer::BufferPool&
+    {
+        return this->buffer_pool_;
+    }
+
+    /**
+     * @brief Obtain a pooled, reference counted buffer with size bytes in use
+     * @details Served from the calling thread's cache of free blocks where possible. 
+     *  Copies of the returned buffer share the same memory.
+     * 
+     * @param size 
+     * @return Buffer::PooledBuffer empty if memory is exhausted
+     */
+    auto AllocateBuffer(std::size_t size) noexcept -> Buffer::PooledBuffer
+    {
+        return this->buffer_pool_.Allocate(size);
+    }
+
+    /**
+     * @brief The timer queue shard serving the calling thread
+     */
+    TimerShardId CurrentTimerShard() const noexcept
+    {
+        if(ThreadInfo const* thread_info{ExecutionContext<ThreadInfo>::RetrieveContent()}) {
+            return thread_info->timer_shard_;
+        }
+        return 0u;
+    }
+
+    TimerShardId TimerShardCount() const noexcept
+    {
+        return this->timer_shard_count_;
+    }
+
     /**
      * @brief Signals the exectutor to stop. Does not block.
      * @details This function wakes up threads blocked in Run()/RunOne(), which should return as soon as the stop "signal" is caught.
@@ -406,13 +494,15 @@ private:
     Result<ProcessStatus> ProcessNextOperation(std::unique_lock<MutexType>& lock, ThreadInfo& this_thread) noexcept;
 
     template <typename TimedTask, typename Duration>
-    Result<PeriodicTaskId> StartTimedTaskAsync(TimedTask&& task, Duration period, TimedTaskType task_type) noexcept;
+    Result<PeriodicTaskId> StartTimedTaskAsync(TimedTask&& task, Duration period, TimedTaskType task_type, 
+        Timer::Types::Duration slack = Timer::Types::Duration{},
+        Timer::Types::CatchUpPolicy catch_up = Timer::Types::CatchUpPolicy::kSkip) noexcept;
 
     template <typename TimedTask>
-    Result<Timer::Types::TimerTag> RegisterTimedTask(TimedTask&& task, TimedTaskType task_type) noexcept;
+    Result<Timer::Types::TimerTag> RegisterTimedTask(TimerManager& timer_shard, TimedTask&& task, TimedTaskType task_type) noexcept;
 
     template <typename TimedTask>
-    const auto MakeOneShotOperation(TimedTask&& task) noexcept;
+    const auto MakeOneShotOperation(TimerShardId shard, TimedTask&& task) noexcept;
 
     template <typename TimedTask>
     const auto MakePeriodicOperation(TimedTask&& task) noexcept;
@@ -429,6 +519,12 @@ private:
 
     void StartReactorTask() noexcept;
 
+    TimerShardId AssignTimerShard() noexcept
+    {
+        return static_cast<TimerShardId>(
+            this->next_timer_shard_.fetch_add(1u, std::memory_order_relaxed) % this->timer_shard_count_);
+    }
+
     void WakeOne() noexcept;
 
     void WakeAll() noexcept;
@@ -436,9 +532,15 @@ private:
     bool IsNullTask(ExecutorOperation& op) const noexcept {return op == nullptr;} //todo what if op is not something that recognizes nullptr (std function does)
     using ReactorService = Util::Optional_NS::Optional<Reactor>;
     using TimerService = Util::Optional_NS::Optional<TimerManager>;
+    using TimerShards = std::array<TimerService, kMaxTimerShards>;
 
+    Buffer::BufferPool buffer_pool_; //declared first so that it outlives everything that may hold pooled buffers
     ReactorService reactor_service_{}; //reactor needs to be declared before timer manager as the latter has dependencies on the former
-    TimerService timer_manager_{};
+    std::once_flag reactor_init_flag_{}; /* per executor, each executor owns its reactor */
+    TimerShards timer_shards_{};
+    std::array<std::once_flag, kMaxTimerShards> timer_shard_init_flags_{};
+    const TimerShardId timer_shard_count_;
+    std::atomic<std::uint32_t> next_timer_shard_{0u};
     std::uint8_t concurrency_hint_{};
     MutexType mtx_; /* protects access on shared members of this class (eg: operation_queue_)*/
     std::condition_variable_any cv_;
@@ -1,7 +1,6 @@
 #ifndef D4D22DAB_A4AD_4790_9E1D_1ABA8EA1F081
 #define D4D22DAB_A4AD_4790_9E1D_1ABA8EA1F081
 
-#include <deque>
 #include <functional>
 #include <mutex>
 #include <memory>
@@ -13,7 +12,6 @@
 
 namespace ExecutorNS{
 using namespace Util::Expected_NS;
-using OperationQueue = std::deque<ExecutorOperation>;
 using StrandJob = ExecutorOperation;
 
 template <typename Executor>
@@ -10,18 +10,30 @@ BasicAcceptorSocket(Executor& executor,
     const BoundEndpointType& endpoint, AcceptorOptions options) noexcept 
     : Base{executor}
 {
+    if(HasOption(options, AcceptorOptions::kExclusiveWakeup))
+        Base::UseExclusiveWakeup();
+
     Base::Open()
     .and_then([this, options](){
         ASRT_LOG_TRACE("Base socket open success");
+        Result<void> result{};
         if constexpr (ProtocolTraits::is_internet_domain<Protocol>::value) {
-            if(options == AcceptorOptions::kReuseAddress) [[likely]] {
-                return Base::SetOption(SocketBase::ReuseAddress{true})
+            if(HasOption(options, AcceptorOptions::kReuseAddress)) [[likely]] {
+                result = Base::SetOption(SocketBase::ReuseAddress{true})
                     .map([](){
                         ASRT_LOG_TRACE("Acceptor set reuse address success");
                     });
             }
+            if(HasOption(options, AcceptorOptions::kReusePort)) {
+                result = result.and_then([this](){
+                        return Base::SetOption(SocketBase::ReusePort{true});
+                    })
+                    .map([](){
+                        ASRT_LOG_TRACE("Acceptor set reuse port success");
+                    });
+            }
         }
-        return Result<void>{};
+        return result;
     })
     .and_then([this, &endpoint](){
         if constexpr (ProtocolTraits::is_unix_domain<Protocol>::value) {
@@ -35,6 +47,28 @@ BasicAcceptorSocket(Executor& executor,
 
 }
 
+template <typename Protocol, class Executor>
+BasicAcceptorSocket<Protocol, Executor>::
+BasicAcceptorSocket(Executor& executor, const Protocol& protocol, 
+    NativeHandleType listening_handle, AcceptorOptions options) noexcept 
+    : Base{executor}
+{
+    if(HasOption(options, AcceptorOptions::kExclusiveWakeup))
+        Base::UseExclusiveWakeup();
+
+    Base::AssignNativeHandle(protocol, listening_handle)
+    .and_then([this](){
+        /* the handle may have been created blocking */
+        return Base::ToggleNonBlockingModeInternal(true);
+    })
+    .map([this](){
+        this->SetAcceptorSocketState(AcceptorSocketState::kListening);
+    })
+    .map_error([listening_handle](SockErrorCode ec){
+        LogFatalAndAbort("Failed to construct acceptor from listening socket {}, {}", listening_handle, ec);
+    });
+}
+
 template <typename Protocol, class Executor>
 BasicAcceptorSocket<Protocol, Executor>::
 BasicAcceptorSocket(BasicAcceptorSocket&& other) noexcept
@@ -58,6 +92,7 @@ OnCloseEvent() noexcept
 {
     ASRT_LOG_TRACE("[Acceptor]: received close event");
     this->SetAcceptorSocketState(AcceptorSocketState::kDisconnected);
+    this->accept_loop_ = false;
     //todo release handler memory?
 }
 
@@ -69,9 +104,12 @@ OnReactorEventImpl(Events events, std::unique_lock<MutexType>& lock) noexcept
 
     ASRT_LOG_TRACE("[Acceptor]: OnReactorEvent()");
     assert(!events.HasWriteEvent()); /* write events are never supposed to be captured by an acceptor socekt */
-    if(this->acceptor_sockstate_ == AcceptorSocketState::kAccepting)
-        this->HandleAysncAccept(lock);
-    else [[unlikely]] {
+    if(this->acceptor_sockstate_ == AcceptorSocketState::kAccepting) {
+        if(this->accept_loop_)
+            this->HandleAcceptLoop(lock);
+        else
+            this->HandleAysncAccept(lock);
+    }else [[unlikely]] {
         ASRT_LOG_INFO("[Acceptor]: Not currently accepting.");
         this->speculative_accept_ = true;
         Base::OnReactorEventIgnored(events);
@@ -97,6 +135,10 @@ HandleAysncAccept(std::unique_lock<MutexType>& lock) noexcept
             auto temp_handler{std::move(this->on_accept_complete_)};
             this->SetAcceptorSocketState(AcceptorSocketState::kListening);
 
+            /* the readiness edge may stand for several queued connections, 
+                the next accept must not wait for another one */
+            this->speculative_accept_ = accept_result.has_value();
+
             lock.unlock();
             ASRT_LOG_TRACE("[Acceptor]: Calling accept handler...");
             temp_handler(std::move(accept_result));
@@ -111,6 +153,96 @@ HandleAysncAccept(std::unique_lock<MutexType>& lock) noexcept
     }
 }
 
+template <typename Protocol, class Executor>
+inline void BasicAcceptorSocket<Protocol, Executor>::
+HandleAcceptLoop(std::unique_lock<MutexType>& lock) noexcept
+{
+    ASRT_LOG_TRACE("[Acceptor]: Handling accept loop");
+
+    /* the handler may stop or restart the loop, it is restored only if the loop it belongs to is still running */
+    AcceptLoopHandler handler{std::move(this->on_accept_loop_)};
+    std::uint32_t const generation{this->accept_loop_generation_};
+    auto const is_running{[this, generation](){
+        return this->accept_loop_ && 
+            this->accept_loop_generation_ == generation &&
+            this->acceptor_sockstate_ == AcceptorSocketState::kAccepting;
+    }};
+
+    bool drained{false};
+    for(std::size_t accepted{0u}; accepted < this->accept_budget_ && is_running(); ++accepted){
+        NativeHandleType const listen_handle{Base::GetNativeHandle()};
+
+        lock.unlock(); /* unlock to allow reactor registration for accepted socket to proceed */
+        Result<NativeHandleType> accept_result{
+            OsAbstraction::AcceptWithoutPeerInfo(listen_handle, SOCK_NONBLOCK)};
+
+        if(!accept_result.has_value() && ErrorCode_Ns::IsBusy(accept_result.error())) {
+            lock.lock();
+            drained = true;
+            break;
+        }
+
+        bool const failed{!accept_result.has_value()};
+        handler(std::move(accept_result));
+        lock.lock();
+
+        if(failed) [[unlikely]] {
+            /* eg: out of file descriptors, retrying right away would spin. wait for the next edge instead */
+            ASRT_LOG_WARN("[Acceptor]: Accept failed, waiting for next connection request");
+            drained = true;
+            break;
+        }
+    }
+
+    if(!is_running()) {
+        ASRT_LOG_TRACE("[Acceptor]: Accept loop stopped");
+        return;
+    }
+
+    this->on_accept_loop_ = std::move(handler);
+    if(drained) [[likely]] {
+        Base::AsyncReadOperationStarted(); /* wait for the next readiness edge */
+    }else{
+        ASRT_LOG_TRACE("[Acceptor]: Accept budget of {} spent, yielding", this->accept_budget_);
+        Base::PostImmediateExecutorJob([this](){ this->ContinueAcceptLoop(); });
+    }
+}
+
+template <typename Protocol, class Executor>
+inline void BasicAcceptorSocket<Protocol, Executor>::
+ContinueAcceptLoop() noexcept
+{
+    std::unique_lock<MutexType> lock{Base::GetMutexUnsafe()};
+    if(this->accept_loop_ && this->acceptor_sockstate_ == AcceptorSocketState::kAccepting) [[likely]]
+        this->HandleAcceptLoop(lock);
+}
+
+template <typename Protocol, class Executor>
+inline void BasicAcceptorSocket<Protocol, Executor>::
+StopAcceptLoop() noexcept
+{
+    std::scoped_lock const lock{Base::GetMutexUnsafe()};
+    if(!this->accept_loop_) [[unlikely]]
+        return;
+
+    ASRT_LOG_TRACE("[Acceptor]: Stopping accept loop");
+    this->accept_loop_ = false;
+    this->on_accept_loop_ = nullptr;
+    if(this->acceptor_sockstate_ == AcceptorSocketState::kAccepting)
+        this->SetAcceptorSocketState(AcceptorSocketState::kListening);
+}
+
+template <typename Protocol, class Executor>
+inline auto BasicAcceptorSocket<Protocol, Executor>::
+AssignAcceptedHandle(AcceptedSocketType& peer_socket, NativeHandleType handle) noexcept -> Result<void>
+{
+    return peer_socket.AssignAcceptedHandle(Base::GetProtocolUnsafe(), handle)
+        .map_error([handle](SockErrorCode ec){
+            static_cast<void>(OsAbstraction::Close(handle));
+            return ec;
+        });
+}
+
 template <typename Protocol, class Executor>
 inline auto BasicAcceptorSocket<Protocol, Executor>::
 BindToEndpointImpl(const BoundEndpointType& ep) noexcept -> Result<void>
@@ -185,7 +317,7 @@ template <typename Protocol, class Executor>
 inline auto BasicAcceptorSocket<Protocol, Executor>::
 DoListen() noexcept -> Result<void>
 {
-    return OsAbstraction::Listen(this->GetNativeHandle(), Socket::details::kDefaultListenConnections)
+    return OsAbstraction::Listen(this->GetNativeHandle(), this->listen_backlog_)
         .map([this](){
             ASRT_LOG_TRACE("[Acceptor]: Listening...");
             this->SetAcceptorSocketState(AcceptorSocketState::kListening);
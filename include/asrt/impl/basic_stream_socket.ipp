@@ -47,13 +47,24 @@ Connect(const EndPointType& remote_ep) noexcept -> Result<void>
         });
 }
 
+template <typename Protocol, class Executor>
+inline auto BasicStreamSocket<Protocol, Executor>::
+Shutdown(Socket::Types::ShutdownType type) noexcept -> Result<void>
+{
+    std::scoped_lock const lock{Base::GetMutex()};
+    return Base::CheckSocketOpen()
+        .and_then([this, type](){
+            return OsAbstraction::Shutdown(this->GetNativeHandle(), static_cast<int>(type));
+        });
+}
+
 template <typename Protocol, class Executor>
 inline auto BasicStreamSocket<Protocol, Executor>::
 CheckRecvPossible() const noexcept -> Result<void> 
 {
     return Base::CheckSocketOpen()
         .and_then([this](){
-            return this->recv_operation_.IsOngoing() ?
+            return this->IsAsyncReceiveInProgress() ?
                 MakeUnexpected(SockErrorCode::receive_operation_ongoing) :
                 Result<void>{};    
         });
@@ -65,7 +76,7 @@ CheckSendPossible() const noexcept -> Result<void>
 {
     return this->CheckIsConnected()
         .and_then([this](){
-            return this->send_operation_.IsOngoing() ?
+            return this->IsAsyncSendInProgress() ?
                 MakeUnexpected(SockErrorCode::send_operation_ongoing) :
                 Result<void>{};
         });
@@ -101,6 +112,16 @@ AssignAcceptedHandle(const Protocol& protocol, NativeHandleType handle) noexcept
         socket handle to a new (not-open) socket. All operations to the socket that may alter
         its internal data could only take place after this API returns */
     ASRT_LOG_TRACE("[BasicStreamSocket]: Assigning accepted socket handle {}", handle);
+
+    /* a recycled socket may still hold operations that never completed on its previous handle */
+    this->send_operation_.Reset();
+    this->send_file_operation_.Reset();
+    this->splice_send_operation_.Reset();
+    this->recv_operation_.Reset();
+    this->splice_recv_operation_.Reset();
+    this->connect_operation_.Reset();
+    this->zero_copy_ = {};
+
     return Base::AssignNativeHandle(protocol, handle)
         .map([this]() {
             this->SetStreamSocketState(BasicStreamSocketState::kConnected);
@@ -126,19 +147,134 @@ DoReceiveSync(ReceiveBuffer recv_view, int flags) noexcept -> ReceiveResult
         });
 }
 
-/* explicit instantiations for async send/recv/connect operations */
+template <typename Protocol, class Executor>
+inline auto BasicStreamSocket<Protocol, Executor>::
+EnableZeroCopy() noexcept -> Result<void>
+{
+    std::scoped_lock const lock{Base::GetMutex()};
+    return Base::SetOption(SocketBase::ZeroCopy{true})
+        .map([this](){
+            this->zero_copy_.enabled_ = true;
+        });
+}
+
+template <typename Protocol, class Executor>
+inline void BasicStreamSocket<Protocol, Executor>::
+OnZeroCopySendComplete(SendCompletionHandler&& callback, SendResult&& result, std::unique_lock<MutexType>* lock) noexcept
+{
+    using Socket::details::ZeroCopyPhase;
+    auto& state{this->zero_copy_};
+
+    state.next_id_ += this->send_operation_.ZeroCopySends();
+    state.handler_ = std::move(callback);
+    state.result_ = std::move(result);
+    state.phase_ = ZeroCopyPhase::kReleasing;
+
+    ASRT_LOG_TRACE("[StreamSocket]: Zero-copy send on sockfd {} awaiting release of {} send call(s)",
+        Base::GetNativeHandle(), static_cast<std::uint32_t>(state.next_id_ - state.released_));
+
+    /* drain before subscribing: completions queued from here on raise an error event, 
+        which the reactor cannot dispatch before we release the socket mutex */
+    this->DrainZeroCopyNotifications();
+    if(state.released_ != state.next_id_) [[likely]] {
+        Base::AsyncErrorQueueOperationStarted();
+        return;
+    }
+
+    state.phase_ = ZeroCopyPhase::kIdle;
+    if(lock == nullptr){ /* initiation context */
+        Base::PostImmediateExecutorJob(
+            [handler = std::move(state.handler_), res = std::move(state.result_)]() mutable {
+                handler(std::move(res));
+            });
+    }else{ /* reactor context */
+        SendCompletionHandler handler{std::move(state.handler_)};
+        SendResult res{std::move(state.result_)};
+        lock->unlock();
+        handler(std::move(res));
+        lock->lock();
+    }
+}
+
+template <typename Protocol, class Executor>
+inline void BasicStreamSocket<Protocol, Executor>::
+HandleZeroCopyRelease(std::unique_lock<MutexType>& lock) noexcept
+{
+    using Socket::details::ZeroCopyPhase;
+    auto& state{this->zero_copy_};
+    ASRT_LOG_TRACE("[StreamSocket]: Handling sockfd {} zero-copy completions", Base::GetNativeHandle());
+
+    this->DrainZeroCopyNotifications();
+    if(state.released_ != state.next_id_) {
+        Base::AsyncErrorQueueOperationStarted();
+        return;
+    }
+
+    ASRT_LOG_TRACE("Notifying zero-copy send completion");
+    state.phase_ = ZeroCopyPhase::kIdle;
+    SendCompletionHandler handler{std::move(state.handler_)};
+    SendResult result{std::move(state.result_)};
+    lock.unlock();
+    /* this is executor context so we directly invoke the handler */
+    handler(std::move(result));
+    lock.lock();
+}
+
+template <typename Protocol, class Executor>
+inline void BasicStreamSocket<Protocol, Executor>::
+DrainZeroCopyNotifications() noexcept
+{
+    auto& state{this->zero_copy_};
+    for(;;){
+        auto const notification{OsAbstraction::ReceiveZeroCopyNotification(Base::GetNativeHandle())};
+        if(!notification.has_value()) {
+            if(!ErrorCode_Ns::IsBusy(notification.error())) [[unlikely]]
+                ASRT_LOG_WARN("[StreamSocket]: Failed to read error queue of sockfd {}, {}", 
+                    Base::GetNativeHandle(), notification.error());
+            return;
+        }
+        if(!notification.value().has_value()) [[unlikely]] 
+            continue;
+
+        std::uint32_t const count{notification.value()->Count()};
+        state.released_ += count;
+        state.statistics_.completions_ += count;
+        if(notification.value()->copied_)
+            state.statistics_.copied_ += count;
+    }
+}
+
+/* explicit instantiations for async send/sendfile/splice/recv/connect operations */
 ASRT_INLINE template class AsyncOperation<
         OperationType::kSend,
-        SendBuffer,
+        SendBufferSequence,
         SendResult,
         SendCompletionHandler>;
 
 template class AsyncOperation<
         OperationType::kReceive,
-        ReceiveBuffer,
+        ReceiveBufferSequence,
         ReceiveResult,
         ReceiveCompletionHandler>;
 
+template class AsyncOperation<
+        OperationType::kSendFile,
+        Types::FileRegion,
+        SendResult,
+        SendCompletionHandler>;
+
+template class AsyncOperation<
+        OperationType::kSpliceReceive,
+        Types::PipeRegion,
+        ReceiveResult,
+        ReceiveCompletionHandler>;
+
+template class AsyncOperation<
+        OperationType::kSpliceSend,
+        Types::PipeRegion,
+        SendResult,
+        SendCompletionHandler>;
+
 template class AsyncOperation<
         OperationType::kConnect,
         SockAddressView,
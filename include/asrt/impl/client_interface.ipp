@@ -4,58 +4,74 @@ namespace ClientServer{
 
 template <typename Executor, typename Protocol, typename Message>
 inline ClientInterface<Executor, Protocol, Message>::
-ClientInterface(Executor& executor, ProcessingMode mode) noexcept
+ClientInterface(Executor& executor, ProcessingMode mode, ClientPoolOptions pool_options) noexcept
+    : pool_{executor, *this, pool_options}
 {
     if(mode == ProcessingMode::kPolling){
         this->inbox_.emplace();
     }
-
-    this->connection_ = ConnectionToServer::Create(executor, *this);
 }
 
 template <typename Executor, typename Protocol, typename Message>
 inline ClientInterface<Executor, Protocol, Message>::
 ~ClientInterface() noexcept
 {
-    this->connection_->Close();
+    this->pool_.Close();
 }
 
 template <typename Executor, typename Protocol, typename Message>
 inline bool ClientInterface<Executor, Protocol, Message>::
 IsConnected() noexcept
 {
-    return this->connection_->IsConnected();
+    return this->pool_.IsConnected();
+}
+
+template <typename Executor, typename Protocol, typename Message>
+inline bool ClientInterface<Executor, Protocol, Message>::
+IsWritable() noexcept
+{
+    auto const target{this->pool_.Select()};
+    return !target || target.connection_->IsWritable();
 }
 
 template <typename Executor, typename Protocol, typename Message>
 inline void ClientInterface<Executor, Protocol, Message>::
 Connect(const Endpoint& server) noexcept
 {
-    this->connection_->ConnectToServer(server, 5s); //retries connection every 5s
+    this->pool_.Connect(server);
 }
 
 template <typename Executor, typename Protocol, typename Message>
 inline void ClientInterface<Executor, Protocol, Message>::
 Disconnect() noexcept
 {
-    this->connection_->Close();
+    this->pool_.Close();
 }
 
 template <typename Executor, typename Protocol, typename Message>
 inline void ClientInterface<Executor, Protocol, Message>::
 Reconnect(const Endpoint& server) noexcept
 {
-    Executor& executor{this->connection_->GetExecutor()};
-    this->connection_ = ConnectionToServer::Create(executor, *this);
-    this->connection_->ConnectToServer(server, 5s); //retries connection every 5s
+    this->pool_.Close(); /* replies to the calls in flight cannot arrive on the new connections */
+    this->pool_.Connect(server);
 }
 
 template <typename Executor, typename Protocol, typename Message>
 inline void ClientInterface<Executor, Protocol, Message>::
 Send(const Message& message) noexcept
 {
-    if(this->IsConnected()) [[likely]]
-        connection_->Send(message);
+    if(auto const target{this->pool_.Select()}) [[likely]]
+        target.connection_->Send(message);
+    else
+        ASRT_LOG_ERROR("Not currently connected to server, send failed");
+}
+
+template <typename Executor, typename Protocol, typename Message>
+inline void ClientInterface<Executor, Protocol, Message>::
+Send(std::uint8_t type, ConstMessageView body) noexcept
+{
+    if(auto const target{this->pool_.Select()}) [[likely]]
+        static_cast<void>(target.connection_->WriteFrame(type, body));
     else
         ASRT_LOG_ERROR("Not currently connected to server, send failed");
 }
@@ -65,7 +81,48 @@ inline void ClientInterface<Executor, Protocol, Message>::
 SendSync(ConstMessageView message) noexcept //todo api needs to return error
 {
     ASRT_LOG_TRACE("Client: SendSync");
-    connection_->SendSync(message);
+    auto target{this->pool_.Select()};
+    if(!target) [[unlikely]]
+        target = this->pool_.Front(); /* keeps the message until connected */
+    if(target) [[likely]]
+        target.connection_->SendSync(message);
+    else
+        ASRT_LOG_ERROR("Not currently connecting to server, send failed");
+}
+
+template <typename Executor, typename Protocol, typename Message>
+inline auto ClientInterface<Executor, Protocol, Message>::
+Call(std::uint16_t method, ConstMessageView payload, RpcHandler handler, CallOptions options) noexcept -> Result<void>
+{
+    auto const target{this->pool_.Select()};
+    if(!target) [[unlikely]]
+        return MakeUnexpected(ErrorCode_Ns::ErrorCode::not_connected);
+
+    /* the reply arrives on the connection the request left on, whose member completes the call */
+    auto& calls{target.member_->GetCalls()};
+    return calls.Add(std::move(handler), options)
+        .and_then([&calls, &target, method, payload](std::uint32_t correlation_id) -> Result<void> {
+            auto const header{RpcHeaderLayout::Encode(correlation_id, method, RpcStatus::kOk)};
+            return target.connection_->WriteFrame(internal::kRpcRequestType, header, payload)
+                .map_error([&calls, correlation_id](ErrorCode_Ns::ErrorCode ec){
+                    calls.Cancel(correlation_id);
+                    return ec;
+                });
+        });
+}
+
+template <typename Executor, typename Protocol, typename Message>
+inline std::size_t ClientInterface<Executor, Protocol, Message>::
+CallsInFlight() const noexcept
+{
+    return this->pool_.CallsInFlight();
+}
+
+template <typename Executor, typename Protocol, typename Message>
+inline std::size_t ClientInterface<Executor, Protocol, Message>::
+ConnectedCount() const noexcept
+{
+    return this->pool_.ConnectedCount();
 }
 
 template <typename Executor, typename Protocol, typename Message>
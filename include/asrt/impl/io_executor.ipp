@@ -5,7 +5,8 @@ namespace ExecutorNS{
 template <class Reactor>
 inline IO_Executor<Reactor>::
 IO_Executor(ExecutorConfig config, std::size_t concurrency_hint) noexcept
-    :
+    : timer_shard_count_{static_cast<TimerShardId>(
+        std::clamp<std::size_t>(concurrency_hint, 1u, kMaxTimerShards))},
 #ifdef EXECUTOR_HAS_THREADS
           single_thread_{concurrency_hint == 1} 
 #else
@@ -39,6 +40,17 @@ CancelTimedJob(PeriodicTaskId task) noexcept -> Result<void>
         });
 }
 
+template <class Reactor>
+inline auto IO_Executor<Reactor>::
+GetTimedJobStatistics(PeriodicTaskId task) noexcept -> Result<Timer::Types::TimerStatistics>
+{
+    if(not this->IsPeriodicJobValid(task)) {
+        return MakeUnexpected(ErrorCode::timer_not_exist);
+    }
+
+    return this->timer_shards_[task.shard_].value().GetTimerStatistics(task.tag_);
+}
+
 template <class Reactor>
 inline auto IO_Executor<Reactor>::
 Run(void) noexcept -> Result<std::size_t>
@@ -50,6 +62,7 @@ Run(void) noexcept -> Result<std::size_t>
     }
 
     ThreadInfo this_thread;
+    this_thread.timer_shard_ = this->AssignTimerShard();
     ExecutionContext<ThreadInfo> ctx_{this_thread};
 
     std::unique_lock<MutexType> lock{this->mtx_};
@@ -85,6 +98,7 @@ RunOne() noexcept
     }
 
     ThreadInfo this_thread;
+    this_thread.timer_shard_ = this->AssignTimerShard();
     ExecutionContext<ThreadInfo> ctx_{this_thread};
 
     std::unique_lock<MutexType> lock{this->mtx_};
@@ -107,8 +121,7 @@ UseReactorService() noexcept -> Reactor&
     ASRT_LOG_DEBUG("Using reactor service");
     static_assert(!std::is_same_v<Reactor, ReactorNS::NullReactor>, "Instantiating a NullReactor is prohibited!");
 
-    static std::once_flag reactor_init_flag;
-    std::call_once(reactor_init_flag, [this](){ /* to protect against concurrent access on the singleton */
+    std::call_once(this->reactor_init_flag_, [this](){ /* to protect against concurrent access on the singleton */
         if(!reactor_service_.has_value()){
             /* failed service construction will trigger an abort */
             this->reactor_service_.emplace(*this, kReactorHandlerCount);
@@ -124,22 +137,30 @@ UseReactorService() noexcept -> Reactor&
 template <class Reactor>
 inline auto IO_Executor<Reactor>::
 UseTimerService() noexcept -> TimerManager&
+{
+    return this->UseTimerService(this->CurrentTimerShard());
+} 
+
+template <class Reactor>
+inline auto IO_Executor<Reactor>::
+UseTimerService(TimerShardId shard) noexcept -> TimerManager&
 {
     static_assert(!std::is_same_v<TimerManager, Timer::NullTimer>, "Instantiating a NullTimer is prohibited!");
+    assert(shard < this->timer_shard_count_);
 
-    ASRT_LOG_DEBUG("Using timer service");
+    ASRT_LOG_DEBUG("Using timer service shard {}", shard);
 
-    static std::once_flag timer_init_flag;
-    std::call_once(timer_init_flag, [this](){
-        if(!this->timer_manager_.has_value()) [[likely]] {
+    auto& timer_shard{this->timer_shards_[shard]};
+    std::call_once(this->timer_shard_init_flags_[shard], [this, shard, &timer_shard](){
+        if(!timer_shard.has_value()) [[likely]] {
             /* failed service construction will trigger an abort */
-            this->timer_manager_.emplace(*this, kConcurrentTimerCountHint);
+            timer_shard.emplace(*this, kConcurrentTimerCountHint, shard);
             this->has_timer_service_ = true;
-            ASRT_LOG_TRACE("Executor now has valid timer");
+            ASRT_LOG_TRACE("Executor now has valid timer shard {}", shard);
         }
     });
     
-    return static_cast<TimerManager &>(this->timer_manager_.value());
+    return static_cast<TimerManager &>(timer_shard.value());
 } 
 
 template <class Reactor>
@@ -181,6 +202,27 @@ OnJobCompletion() noexcept
 
 /********************* private methods *********************/
 
+template <class Reactor>
+inline void IO_Executor<Reactor>::
+PostBatch(OperationQueue& ops) noexcept
+{
+    if(ops.empty()) [[unlikely]] return;
+
+    ASRT_LOG_TRACE("Posting batch of {} job(s)", ops.size());
+    const std::size_t batch_size{ops.size()};
+    this->job_count_.fetch_add(static_cast<std::uint32_t>(batch_size), std::memory_order_acq_rel);
+
+    std::scoped_lock const lock{this->mtx_};
+    std::ranges::move(ops, std::back_inserter(this->operation_queue_));
+    ops.clear();
+
+    if(batch_size > 1){
+        this->WakeAll(); /* let as many workers as possible share the batch */
+    }else{
+        this->WakeOne();
+    }
+}
+
 template <class Reactor>
 inline auto IO_Executor<Reactor>::
 ProcessNextOperation(std::unique_lock<MutexType>& lock, ThreadInfo& this_thread) noexcept -> Result<ProcessStatus>
@@ -295,7 +337,7 @@ ProcessNextOperation(std::unique_lock<MutexType>& lock, ThreadInfo& this_thread)
             //assert(lock.owns_lock());
             this->cv_wait_count_++;
             ASRT_LOG_TRACE("Queue empty about to block waiting for incoming events");
-            this->cv_.wait(lock, [this](){return not this->operation_queue_.empty();});  /* block on condvar; lock is unlocked inside cv */
+            this->cv_.wait(lock, [this](){return this->stop_requested_ || not this->operation_queue_.empty();});  /* block on condvar; lock is unlocked inside cv */
             this->cv_wait_count_--;
         }
     } //while (not stop requested)
@@ -307,16 +349,24 @@ ProcessNextOperation(std::unique_lock<MutexType>& lock, ThreadInfo& this_thread)
 template <class Reactor>
 template <typename TimedTask, typename Duration>
 inline auto IO_Executor<Reactor>::
-StartTimedTaskAsync(TimedTask&& task, Duration period, TimedTaskType task_type) noexcept -> Result<PeriodicTaskId>
+StartTimedTaskAsync(TimedTask&& task, Duration period, TimedTaskType task_type, 
+    Timer::Types::Duration slack, Timer::Types::CatchUpPolicy catch_up) noexcept -> Result<PeriodicTaskId>
 {
-    return this->RegisterTimedTask(std::move(task), task_type)
-        .and_then([this, period, task_type](Timer::Types::TimerTag handle) -> Result<PeriodicTaskId> {
+    /* timed tasks live in the shard of the posting thread */
+    TimerManager& timer_shard{this->UseTimerService()};
+
+    return this->RegisterTimedTask(timer_shard, std::move(task), task_type)
+        .and_then([this, &timer_shard, period, task_type, slack, catch_up](Timer::Types::TimerTag handle) -> Result<PeriodicTaskId> {
             const auto task_period{(task_type == TimedTaskType::kRecurring) ? period : Duration{}};
-            return this->timer_manager_.value().AddTimer(handle, Clock::now() + period, task_period)
-                .map([this, handle]() {
-                    this->periodic_job_ids_.push_back(handle);
+            return timer_shard.SetCatchUpPolicy(handle, catch_up)
+                .and_then([&timer_shard, handle, period, task_period, slack](){
+                    return timer_shard.AddTimer(handle, Clock::now() + period, task_period, slack);
+                })
+                .map([this, &timer_shard, handle]() {
+                    const PeriodicTaskId task_id{timer_shard.GetShardId(), handle};
+                    this->periodic_job_ids_.push_back(task_id);
                     this->OnJobArrival();
-                    return handle;
+                    return task_id;
                 });
         })
         .map_error([](ErrorCode ec){
@@ -330,13 +380,13 @@ StartTimedTaskAsync(TimedTask&& task, Duration period, TimedTaskType task_type)
 template <class Reactor>
 template <typename TimedTask>
 inline auto IO_Executor<Reactor>::
-RegisterTimedTask(TimedTask&& task, TimedTaskType task_type) noexcept -> Result<Timer::Types::TimerTag>
+RegisterTimedTask(TimerManager& timer_shard, TimedTask&& task, TimedTaskType task_type) noexcept -> Result<Timer::Types::TimerTag>
 {
     if(task_type == TimedTaskType::kOnce){
-        return this->timer_manager_.value().RegisterTimer(
-            this->MakeOneShotOperation(std::move(task)));
+        return timer_shard.RegisterTimer(
+            this->MakeOneShotOperation(timer_shard.GetShardId(), std::move(task)));
     }else{
-        return this->timer_manager_.value().RegisterTimer(
+        return timer_shard.RegisterTimer(
             this->MakePeriodicOperation(std::move(task)));
     }
 }
@@ -344,12 +394,12 @@ RegisterTimedTask(TimedTask&& task, TimedTaskType task_type) noexcept -> Result<
 template <class Reactor>
 template <typename TimedTask>
 inline const auto IO_Executor<Reactor>::
-MakeOneShotOperation(TimedTask&& task) noexcept
+MakeOneShotOperation(TimerShardId shard, TimedTask&& task) noexcept
 {
     return 
-        [this, one_time_task = std::move(task)](typename TimerManager::TimerTag tag){
+        [this, shard, one_time_task = std::move(task)](typename TimerManager::TimerTag tag){
             one_time_task();
-            (void)this->RemoveTimedTaskAsync(tag);
+            (void)this->RemoveTimedTaskAsync(PeriodicTaskId{shard, tag});
         };
 }
 
@@ -369,7 +419,7 @@ RemoveTimedTaskAsync(PeriodicTaskId task_id) noexcept -> Result<void>
 {
     /* assumes task id is already validated on function entry */
     Util::QuickRemoveOne(this->periodic_job_ids_, task_id);
-    return this->timer_manager_.value().RemoveTimer(task_id);
+    return this->timer_shards_[task_id.shard_].value().RemoveTimer(task_id.tag_);
 }
 
 template <class Reactor>
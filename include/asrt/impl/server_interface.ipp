@@ -7,8 +7,10 @@ inline ServerInterface<Executor, Protocol, Message>::
 ServerInterface(const Endpoint& endpoint, ProcessingMode mode) noexcept
     : executor_{}, acceptor_{executor_, endpoint} 
 {
-    if(mode == ProcessingMode::kPolling)
+    if(mode == ProcessingMode::kPolling){
         this->inbox_.emplace();
+        this->drained_messages_.resize(internal::kProcessBatchSize);
+    }
 }
 
 template<typename Executor, typename Protocol, typename Message>
@@ -26,21 +28,27 @@ inline void ServerInterface<Executor, Protocol, Message>::
 Stop() noexcept
 {
     this->executor_.Stop();
+    if(this->inbox_.has_value())
+        this->inbox_->Interrupt();
 }
 
 template<typename Executor, typename Protocol, typename Message>
 inline void ServerInterface<Executor, Protocol, Message>::
 DoMessageClient(Client& client, ConstMessageView message) noexcept
 {
-    if(client && client->IsConnected()){
-        client->SendSync(message); //todo sendsync or plain send ?
+    if(!client) [[unlikely]]
+        return;
+
+    if(client->IsConnected()) [[likely]] {
+        /* coalesced with the other messages of this turn */
+        static_cast<void>(client->Write(message));
     }else{
         ASRT_LOG_TRACE("Server interface: detected disconnection when messaging client {}",
             client->GetId());
         /* notify server of disconnect event */
         this->OnClientDisconnect(client);
-        //this->RemoveConnection(client->GetId()); //todo mark this conenction for later removal
-        //todo attempting to remove it here leads to deadlock as mutex is possibly acquired earlier
+        /* the caller may be iterating the connections or still hold on to this one */
+        this->ScheduleRemoveConnection(client->GetId());
     }
 }
 
@@ -48,10 +56,9 @@ template<typename Executor, typename Protocol, typename Message>
 inline void ServerInterface<Executor, Protocol, Message>::
 MessageClientById(ClientId client_id, ConstMessageView message) noexcept
 {
-    std::scoped_lock const lock{this->connection_storage_mutex_};
-    const auto client_it{this->GetClientPositionInQueue(client_id)};
-    if(client_it != this->connections_.end()){
-        this->DoMessageClient(*client_it, message);
+    /* no lock is held while sending */
+    if(Client client{this->connections_.Find(client_id)}; client) [[likely]] {
+        this->DoMessageClient(client, message);
     }else [[unlikely]] {
         //todo maybe return this error to application
         spdlog::error("Unable to find client to send message to. Client id {}",
@@ -66,27 +73,202 @@ MessageClient(Client& client, ConstMessageView message) noexcept
     this->DoMessageClient(client, message);
 }
 
+template<typename Executor, typename Protocol, typename Message>
+inline auto ServerInterface<Executor, Protocol, Message>::
+Respond(Client const& client, RpcRequest const& request, ConstMessageView payload, RpcStatus status) noexcept -> Result<void>
+{
+    if(!client) [[unlikely]]
+        return MakeUnexpected(ErrorCode_Ns::ErrorCode::invalid_argument);
+
+    auto const header{RpcHeaderLayout::Encode(request.CorrelationId(), request.Method(), status)};
+    return client->WriteFrame(internal::kRpcResponseType, header, payload);
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline void ServerInterface<Executor, Protocol, Message>::
+OnRpcRequest(Client client, Frame&& frame) noexcept
+{
+    auto request{RpcRequest::FromFrame(std::move(frame))};
+    if(!request.has_value()) [[unlikely]] {
+        ASRT_LOG_WARN("Client {} sent a malformed rpc request, dropping it", client->GetId());
+        return;
+    }
+    this->OnRequest(std::move(client), std::move(request.value()));
+}
+
 template<typename Executor, typename Protocol, typename Message>
 inline void ServerInterface<Executor, Protocol, Message>::
 MessageAllClients(ConstMessageView message) noexcept
 {
-    std::scoped_lock const lock{this->connection_storage_mutex_};
-    std::ranges::for_each(this->connections_,
-        [this, message](auto& conn){
-            this->DoMessageClient(conn, message);
+    /* connections accepted or removed meanwhile do not affect the snapshot being iterated */
+    auto const snapshot{this->connections_.GetSnapshot()};
+    for(Client client : *snapshot){
+        this->DoMessageClient(client, message);
+    }
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline auto ServerInterface<Executor, Protocol, Message>::
+BroadcastAsync(ConstMessageView message, BroadcastOptions options, BroadcastHandler handler) noexcept -> Result<void>
+{
+    Buffer::PooledBuffer encoded{this->executor_.AllocateBuffer(message.size())};
+    if(!encoded) [[unlikely]]
+        return MakeUnexpected(ErrorCode_Ns::ErrorCode::no_memory);
+
+    std::memcpy(encoded.data(), message.data(), message.size());
+    this->BroadcastAsync(std::move(encoded), options, std::move(handler));
+    return Result<void>{};
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline void ServerInterface<Executor, Protocol, Message>::
+BroadcastAsync(Buffer::PooledBuffer message, BroadcastOptions options, BroadcastHandler handler) noexcept
+{
+    options.recipients_per_job_ = std::max<std::size_t>(options.recipients_per_job_, 1u);
+    auto recipients{this->connections_.GetSnapshot()};
+    std::size_t const count{recipients->size()};
+    std::size_t const jobs{std::max<std::size_t>( /* one to report if no client is connected */
+        (count + options.recipients_per_job_ - 1u) / options.recipients_per_job_, 1u)};
+
+    auto broadcast{std::make_shared<BroadcastState>(
+        std::move(recipients), std::move(message), options, std::move(handler), jobs)};
+    {
+        std::scoped_lock const lock{this->broadcast_mutex_};
+        if(this->broadcast_in_progress_){
+            this->queued_broadcasts_.emplace_back(std::move(broadcast));
+            return;
+        }
+        this->broadcast_in_progress_ = true;
+    }
+    this->StartBroadcast(std::move(broadcast));
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline void ServerInterface<Executor, Protocol, Message>::
+StartBroadcast(std::shared_ptr<BroadcastState> broadcast) noexcept
+{
+    std::size_t const count{broadcast->recipients_->size()};
+    std::size_t const per_job{broadcast->options_.recipients_per_job_};
+    ASRT_LOG_TRACE("Broadcasting {} bytes to {} client(s)", broadcast->message_.size(), count);
+
+    ExecutorNS::OperationQueue fan_out;
+    for(std::size_t first{0u}; first < count || fan_out.empty(); first += per_job){
+        fan_out.emplace_back([this, broadcast, first, last = std::min(first + per_job, count)](){
+            this->BroadcastToRange(*broadcast, first, last);
         });
+    }
+    this->executor_.PostBatch(fan_out);
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline void ServerInterface<Executor, Protocol, Message>::
+BroadcastToRange(BroadcastState& broadcast, std::size_t first, std::size_t last) noexcept
+{
+    using Clock = typename BroadcastState::Clock;
+    typename Clock::time_point first_queued{};
+    std::size_t queued{0u}, skipped{0u}, disconnected{0u}, rejected{0u};
+
+    for(std::size_t i{first}; i < last; ++i){
+        Client const& client{(*broadcast.recipients_)[i]};
+        if(!client->IsConnected()) [[unlikely]] {
+            ++skipped; /* disconnects are handled by the connection's error path */
+            continue;
+        }
+
+        if(broadcast.options_.policy_ != BroadcastPolicy::kQueue && !client->IsWritable()) [[unlikely]] {
+            if(broadcast.options_.policy_ == BroadcastPolicy::kDisconnect){
+                ASRT_LOG_INFO("Client {} too slow for broadcast, disconnecting", client->GetId());
+                client->Close();
+                ++disconnected;
+            }else{
+                ++skipped;
+            }
+            continue;
+        }
+
+        if(client->Write(broadcast.message_).has_value()) [[likely]] {
+            if(queued++ == 0u) first_queued = Clock::now();
+        }else{
+            ++rejected;
+        }
+    }
+
+    if(queued != 0u)
+        broadcast.RecordQueued(first_queued, Clock::now());
+    broadcast.queued_.fetch_add(queued, std::memory_order_relaxed);
+    broadcast.skipped_.fetch_add(skipped, std::memory_order_relaxed);
+    broadcast.disconnected_.fetch_add(disconnected, std::memory_order_relaxed);
+    broadcast.rejected_.fetch_add(rejected, std::memory_order_relaxed);
+
+    if(broadcast.JobDone())
+        this->OnBroadcastDone(broadcast);
 }
 
 template<typename Executor, typename Protocol, typename Message>
 inline void ServerInterface<Executor, Protocol, Message>::
+OnBroadcastDone(BroadcastState& broadcast) noexcept
+{
+    std::shared_ptr<BroadcastState> next;
+    {
+        std::scoped_lock const lock{this->broadcast_mutex_};
+        if(this->queued_broadcasts_.empty()){
+            this->broadcast_in_progress_ = false;
+        }else{
+            next = std::move(this->queued_broadcasts_.front());
+            this->queued_broadcasts_.pop_front();
+        }
+    }
+    if(next)
+        this->StartBroadcast(std::move(next));
+
+    if(broadcast.handler_)
+        broadcast.handler_(broadcast.Report());
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline void ServerInterface<Executor, Protocol, Message>::
+SetClientWriteOptions(WriteOptions options) noexcept
+{
+    this->client_write_options_ = options;
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline void ServerInterface<Executor, Protocol, Message>::
+ReserveClientConnections(std::size_t count) noexcept
+{
+    this->connection_pool_.Reserve(count, this->executor_, *this);
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline std::size_t ServerInterface<Executor, Protocol, Message>::
 Process(std::size_t max_messages) noexcept
 {
     assert(this->inbox_.has_value()); //polling mode
-    std::size_t msg_processed{};
-    while(!this->inbox_.is_empty() && msg_processed < max_messages){
-        auto msg{this->inbox_.Pop()};
-        this->OnMessage(msg.source_, std::move(msg.msg_));
+    std::size_t msg_processed{0u};
+    while(msg_processed < max_messages){
+        std::size_t const drained{this->inbox_->DrainInto(
+            std::span{this->drained_messages_}, max_messages - msg_processed)};
+        if(drained == 0u)
+            break;
+
+        for(IncomingMessage& msg : std::span{this->drained_messages_}.first(drained)){
+            if(msg.msg_.Type() == internal::kRpcRequestType) [[unlikely]]
+                this->OnRpcRequest(std::move(msg.source_), std::move(msg.msg_));
+            else
+                this->OnMessage(std::move(msg.source_), msg.msg_.Data());
+            msg = IncomingMessage{};
+        }
+        msg_processed += drained;
     }
+    return msg_processed;
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline bool ServerInterface<Executor, Protocol, Message>::
+WaitForMessages() noexcept
+{
+    assert(this->inbox_.has_value()); //polling mode
+    return this->inbox_->Wait();
 }
 
 template<typename Executor, typename Protocol, typename Message>
@@ -102,37 +284,50 @@ template<typename Executor, typename Protocol, typename Message>
 inline void ServerInterface<Executor, Protocol, Message>::
 WaitForClientConnections() noexcept
 {
-    std::shared_ptr<ConnectionToClient> new_connection{
-        ConnectionToClient::Create(this->executor_, *this, next_client_id_++)};
-
-    this->acceptor_.AcceptAsync(new_connection->GetSocket(),
-        [this, new_connection](auto accept_result) mutable {
+    /* connection storms are drained in batches instead of re-arming the acceptor per connection */
+    static_cast<void>(this->acceptor_.AcceptLoopAsync(
+        [this](auto accept_result) {
             if(accept_result.has_value()) [[likely]] {
-
-                if constexpr (ProtocolTraits::is_internet_domain<Protocol>::value){
-                    ASRT_LOG_INFO("Client connect request from {}",    
-                        new_connection->GetSocket().GetRemoteEndpoint());
-                }else{
-                    ASRT_LOG_INFO("Client connect request from {}",    
-                        new_connection->GetSocket().GetPeerCredentials());                    
-                }
-
-                if(OnClientConnect(new_connection)){
-                    ASRT_LOG_INFO("Accepted new client, assined id {}", new_connection->GetId());
-                    new_connection->InitiateHandshake();
-                    {
-                        std::scoped_lock const lock{this->connection_storage_mutex_};
-                        this->connections_.emplace_back(std::move(new_connection));
-                    }
-                }else{
-                    ASRT_LOG_WARN("Denied client connection.");
-                }
+                this->OnClientAccepted(accept_result.value());
             }else [[unlikely]] {
                 ASRT_LOG_ERROR("Failed to accept client, {}",
                     accept_result.error());
             }
-            this->WaitForClientConnections();
-        });
+        })
+        .map_error([](ErrorCode_Ns::ErrorCode ec){
+            LogFatalAndAbort("Failed to start accepting clients, {}", ec);
+            return ec;
+        }));
+}
+
+template<typename Executor, typename Protocol, typename Message>
+inline void ServerInterface<Executor, Protocol, Message>::
+OnClientAccepted(asrt::NativeHandle handle) noexcept
+{
+    std::shared_ptr<ConnectionToClient> new_connection{
+        this->connection_pool_.Acquire(this->executor_, *this, next_client_id_++, this->client_write_options_)};
+
+    if(auto const assign_result{this->acceptor_.AssignAcceptedHandle(new_connection->GetSocket(), handle)};
+        !assign_result.has_value()) [[unlikely]] {
+        ASRT_LOG_ERROR("Failed to set up accepted client, {}", assign_result.error());
+        return;
+    }
+
+    if constexpr (ProtocolTraits::is_internet_domain<Protocol>::value){
+        ASRT_LOG_INFO("Client connect request from {}",    
+            new_connection->GetSocket().GetRemoteEndpoint());
+    }else{
+        ASRT_LOG_INFO("Client connect request from {}",    
+            new_connection->GetSocket().GetPeerCredentials());                    
+    }
+
+    if(OnClientConnect(new_connection)){
+        ASRT_LOG_INFO("Accepted new client, assined id {}", new_connection->GetId());
+        new_connection->InitiateHandshake();
+        static_cast<void>(this->connections_.Insert(std::move(new_connection)));
+    }else{
+        ASRT_LOG_WARN("Denied client connection.");
+    }
 }
 
 template<typename Executor, typename Protocol, typename Message>
@@ -158,35 +353,28 @@ OnConnectionError(Client client, ErrorCode_Ns::ErrorCode ec) noexcept
         ASRT_LOG_INFO("Client failed authentication, dropping connection.");
     }
 
-    this->RemoveConnection(client_id);
+    this->ScheduleRemoveConnection(client_id);
 }
 
 template<typename Executor, typename Protocol, typename Message>
 inline void ServerInterface<Executor, Protocol, Message>::
 RemoveConnection(ConnectionId conn_id) noexcept
 {
-    std::scoped_lock const lock{this->connection_storage_mutex_};
-    ASRT_LOG_TRACE("Connection size {} before removal", 
-        connections_.size());
-
-    Util::QuickRemoveOneIf(this->connections_, 
-        [conn_id](const auto& conn){
-            return conn->GetId() == conn_id;
-        });
-
-    ASRT_LOG_DEBUG("Removed connection {}", conn_id);
-    ASRT_LOG_TRACE("Connection size {} after removal", 
-        connections_.size());
+    if(Client const removed{this->connections_.Erase(conn_id)}; removed){
+        ASRT_LOG_DEBUG("Removed connection {}", conn_id);
+        ASRT_LOG_TRACE("Connection size {} after removal", 
+            this->connections_.Size());
+    }
 }
 
-//! not thread safe. protect with mutex before calling
 template<typename Executor, typename Protocol, typename Message>
-inline auto ServerInterface<Executor, Protocol, Message>::
-GetClientPositionInQueue(ClientId client_id) noexcept
+inline void ServerInterface<Executor, Protocol, Message>::
+ScheduleRemoveConnection(ConnectionId conn_id) noexcept
 {
-    return std::ranges::find_if(this->connections_,
-        [client_id](const auto& conn){
-            return conn->GetId() == client_id;
-        });
+    /* removed once the caller has returned, the last reference must neither be dropped 
+        under the lock of the connection's own socket nor while the caller still uses the connection */
+    this->executor_.Post([this, conn_id](){
+        this->RemoveConnection(conn_id);
+    });
 }
 }//end ns
\ No newline at end of file
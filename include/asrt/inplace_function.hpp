@@ -0,0 +1,198 @@
+#ifndef B48A1AB3_1784_4692_8887_666FC6E6E2E9
+#define B48A1AB3_1784_4692_8887_666FC6E6E2E9
+
+#include <cstddef>
+#include <cassert>
+#include <new>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <type_traits>
+
+namespace asrt{
+
+template <typename Signature, std::size_t Capacity>
+class InplaceFunction;
+
+/**
+ * @brief A move-only type-erased callable with small buffer optimization
+ * @details Callables of up to Capacity bytes are stored inside the object itself so that
+ *  (re)assigning one does not allocate. The storage of a long lived InplaceFunction (eg: a
+ *  timer slot) is thereby reused for every callable it ever holds. Callables too large for
+ *  the buffer, over-aligned or throwing on move are stored on the heap instead.
+ *
+ * @tparam R return type
+ * @tparam Args argument types
+ * @tparam Capacity size of the inline buffer in bytes
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+public:
+    static constexpr std::size_t kCapacity{Capacity};
+    static constexpr std::size_t kAlignment{alignof(std::max_align_t)};
+
+    static_assert(kCapacity >= sizeof(void*), "Inline buffer must at least hold a pointer");
+
+    /**
+     * @brief Whether a callable of type F is stored without allocating
+     */
+    template <typename F>
+    static constexpr bool kStoredInplace{
+        (sizeof(F) <= kCapacity) &&
+        (alignof(F) <= kAlignment) &&
+        std::is_nothrow_move_constructible_v<F>};
+
+    InplaceFunction() noexcept = default;
+
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template <typename F>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction>) &&
+                 std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    InplaceFunction(F&& f) noexcept(kStoredInplace<std::decay_t<F>> &&
+        std::is_nothrow_constructible_v<std::decay_t<F>, F>)
+    {
+        this->Emplace<std::decay_t<F>>(std::forward<F>(f));
+    }
+
+    /* non-copyable but movable */
+    InplaceFunction(InplaceFunction const&) = delete;
+    InplaceFunction& operator=(InplaceFunction const&) = delete;
+
+    InplaceFunction(InplaceFunction&& other) noexcept
+    {
+        this->MoveFrom(other);
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept
+    {
+        if(this != &other){
+            this->Reset();
+            this->MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept
+    {
+        this->Reset();
+        return *this;
+    }
+
+    template <typename F>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction>) &&
+                 std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    InplaceFunction& operator=(F&& f) noexcept(kStoredInplace<std::decay_t<F>> &&
+        std::is_nothrow_constructible_v<std::decay_t<F>, F>)
+    {
+        this->Reset();
+        this->Emplace<std::decay_t<F>>(std::forward<F>(f));
+        return *this;
+    }
+
+    ~InplaceFunction() noexcept
+    {
+        this->Reset();
+    }
+
+    R operator()(Args... args)
+    {
+        assert(this->vtable_ != nullptr);
+        return this->vtable_->invoke(this->storage_, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return this->vtable_ != nullptr;
+    }
+
+    friend bool operator==(InplaceFunction const& f, std::nullptr_t) noexcept
+    {
+        return !f;
+    }
+
+private:
+    struct VTable{
+        R (*invoke)(void* storage, Args&&... args);
+        void (*move)(void* dst, void* src) noexcept; /* move constructs dst from src and destroys src */
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template <typename F>
+    static F& Inplace(void* storage) noexcept
+    {
+        return *std::launder(static_cast<F*>(storage));
+    }
+
+    template <typename F>
+    static F*& OnHeap(void* storage) noexcept
+    {
+        return *std::launder(static_cast<F**>(storage));
+    }
+
+    template <typename F>
+    static constexpr VTable kInplaceVTable{
+        .invoke = [](void* storage, Args&&... args) -> R {
+            return std::invoke(Inplace<F>(storage), std::forward<Args>(args)...);
+        },
+        .move = [](void* dst, void* src) noexcept {
+            ::new (dst) F(std::move(Inplace<F>(src)));
+            Inplace<F>(src).~F();
+        },
+        .destroy = [](void* storage) noexcept {
+            Inplace<F>(storage).~F();
+        }
+    };
+
+    template <typename F>
+    static constexpr VTable kHeapVTable{
+        .invoke = [](void* storage, Args&&... args) -> R {
+            return std::invoke(*OnHeap<F>(storage), std::forward<Args>(args)...);
+        },
+        .move = [](void* dst, void* src) noexcept {
+            ::new (dst) F*(OnHeap<F>(src)); /* ownership is simply handed over */
+        },
+        .destroy = [](void* storage) noexcept {
+            delete OnHeap<F>(storage);
+        }
+    };
+
+    template <typename F, typename Callable>
+    void Emplace(Callable&& f)
+    {
+        if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>) {
+            if(f == nullptr) return; /* an empty function pointer makes an empty function */
+        }
+
+        if constexpr (kStoredInplace<F>) {
+            ::new (static_cast<void*>(this->storage_)) F(std::forward<Callable>(f));
+            this->vtable_ = &kInplaceVTable<F>;
+        } else {
+            ::new (static_cast<void*>(this->storage_)) F*(new F(std::forward<Callable>(f)));
+            this->vtable_ = &kHeapVTable<F>;
+        }
+    }
+
+    void MoveFrom(InplaceFunction& other) noexcept
+    {
+        if(other.vtable_ != nullptr){
+            other.vtable_->move(this->storage_, other.storage_);
+            this->vtable_ = std::exchange(other.vtable_, nullptr);
+        }
+    }
+
+    void Reset() noexcept
+    {
+        if(this->vtable_ != nullptr){
+            std::exchange(this->vtable_, nullptr)->destroy(this->storage_);
+        }
+    }
+
+    alignas(kAlignment) std::byte storage_[kCapacity];
+    VTable const* vtable_{nullptr};
+};
+
+} //end ns asrt
+
+#endif /* B48A1AB3_1784_4692_8887_666FC6E6E2E9 */
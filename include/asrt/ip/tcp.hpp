@@ -4,6 +4,7 @@
 #include "asrt/config.hpp"
 #include "asrt/socket/protocol.hpp"
 #include "asrt/socket/acceptor.hpp"
+#include "asrt/socket/acceptor_group.hpp"
 #include "asrt/socket/internet_endpoint.hpp"
 #include "asrt/socket/basic_stream_socket.hpp"
 #include "asrt/timer/timer_queue.hpp"
@@ -24,9 +25,12 @@ using ProtocolType = ProtocolNS::TCP;
 using executor = asrt::config::DefaultExecutor;
 using socket = Socket::BasicStreamSocket<ProtocolType, executor>;
 using acceptor = Socket::BasicAcceptorSocket<ProtocolType, executor>;
+using acceptor_group = Socket::ReusePortAcceptorGroup<ProtocolType, executor>;
 using endpoint = IP::BasicEndpoint<ProtocolType>;
 using no_delay = SockOption::BoolOption<IPPROTO_TCP, TCP_NODELAY>;
+using cork = SockOption::BoolOption<IPPROTO_TCP, TCP_CORK>;
 using reuse_addr = Socket::SocketBase::ReuseAddress;
+using reuse_port = Socket::SocketBase::ReusePort;
 using port = endpoint::PortNumber;
 
 
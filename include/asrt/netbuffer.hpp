@@ -8,6 +8,18 @@
 #include <algorithm>
 #include <string>
 #include <string_view>
+#include <cassert>
+#include <type_traits>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <sys/uio.h>
+
+#include "asrt/details/byte_scan.hpp"
 
 namespace Buffer
 {
@@ -17,6 +29,9 @@ namespace Buffer
 
     inline constexpr std::size_t kDynamicExtent = -1;
 
+    /* default maximum number of buffers in a scatter/gather sequence. well below IOV_MAX */
+    inline constexpr std::size_t kMaxBufferSequenceLength = 16;
+
     class MutableBufferView;
     class ConstBufferView;
 
@@ -245,6 +260,261 @@ namespace Buffer
 
     };
 
+    /**
+     * @brief A fixed capacity sequence of buffer views for scatter/gather i/o
+     * @details The views are kept as an array of ::iovec so that the sequence can be 
+     *  handed to readv()/writev()/sendmsg()/recvmsg() as is. Advance() consumes bytes 
+     *  across view boundaries which allows a partially completed vectored operation 
+     *  to be resumed with the remainder of the sequence. Empty views are dropped.
+     * 
+     * @tparam BufferView MutableBufferView or ConstBufferView
+     * @tparam MaxBuffers maximum number of views in the sequence
+     */
+    template <typename BufferView, std::size_t MaxBuffers = kMaxBufferSequenceLength>
+    class BasicBufferSequence
+    {
+        std::array<::iovec, MaxBuffers> iovecs_{};
+        std::size_t first_{}; /* index of first view not yet fully consumed */
+        std::size_t count_{}; /* number of views pushed */
+        std::size_t size_{}; /* remaining byte size of all views */
+
+    public:
+        static constexpr std::size_t kMaxBuffers{MaxBuffers};
+
+        constexpr BasicBufferSequence() noexcept = default;
+
+        /* a single view is a sequence of one */
+        template <typename View>
+            requires std::is_convertible_v<View, BufferView>
+        BasicBufferSequence(View const& view) noexcept
+        {
+            (void)this->Push(BufferView{view});
+        }
+
+        /* more views than fit are rejected at compile time, use Push() to build a sequence of runtime length */
+        template <typename... Views>
+            requires (sizeof...(Views) > 1u) && (sizeof...(Views) <= MaxBuffers) && 
+                (std::is_convertible_v<Views, BufferView> && ...)
+        BasicBufferSequence(Views const&... views) noexcept
+        {
+            ((void)this->Push(BufferView{views}), ...);
+        }
+
+        /* a mutable sequence may be used wherever a const sequence is expected */
+        template <typename OtherView>
+            requires (!std::is_same_v<OtherView, BufferView> && std::is_convertible_v<OtherView, BufferView>)
+        BasicBufferSequence(BasicBufferSequence<OtherView, MaxBuffers> const& other) noexcept
+        {
+            for(std::size_t i{}; i < other.Count(); ++i)
+                (void)this->Push(other[i]);
+        }
+
+        /**
+         * @brief Append view to the end of the sequence
+         * 
+         * @param view 
+         * @return false if the sequence is already full
+         */
+        [[nodiscard]] bool Push(BufferView view) noexcept
+        {
+            if(view.size() == 0) return true;
+            if(this->count_ == MaxBuffers) [[unlikely]] return false;
+
+            /* ::iovec has no notion of constness; the kernel only reads from const views */
+            this->iovecs_[this->count_++] = ::iovec{
+                const_cast<void*>(static_cast<const void*>(view.data())), view.size()};
+            this->size_ += view.size();
+            return true;
+        }
+
+        /* Acquire the number of views not yet fully consumed */
+        constexpr std::size_t Count() const noexcept { return this->count_ - this->first_; }
+
+        /* Acquire the remaining byte size of all views */
+        constexpr std::size_t size() const noexcept { return this->size_; }
+
+        [[nodiscard]] constexpr bool 
+        Empty() const noexcept { return this->size_ == 0; }
+
+        [[nodiscard]] BufferView operator[](std::size_t index) const noexcept
+        {
+            assert(index < this->Count());
+            ::iovec const& iov{this->iovecs_[this->first_ + index]};
+            return BufferView{iov.iov_base, iov.iov_len};
+        }
+
+        [[nodiscard]] BufferView Front() const noexcept { return (*this)[0]; }
+
+        /* Acquire the remaining views as ::iovec array, eg: for ::msghdr::msg_iov */
+        ::iovec const* Iovecs() const noexcept { return this->iovecs_.data() + this->first_; }
+
+        /* Consume the specified number of bytes from the front of the sequence, crossing view boundaries */
+        void Advance(std::size_t n) noexcept
+        {
+            n = std::min(n, this->size_);
+            this->size_ -= n;
+            while(n > 0){
+                ::iovec& iov{this->iovecs_[this->first_]};
+                if(n < iov.iov_len){
+                    iov.iov_base = static_cast<std::uint8_t*>(iov.iov_base) + n;
+                    iov.iov_len -= n;
+                    break;
+                }
+                n -= iov.iov_len;
+                ++this->first_;
+            }
+        }
+
+        BasicBufferSequence &operator+=(std::size_t n) noexcept
+        {
+            this->Advance(n);
+            return *this;
+        }
+    };
+
+    using MutableBufferSequence = BasicBufferSequence<MutableBufferView>;
+    using ConstBufferSequence = BasicBufferSequence<ConstBufferView>;
+
+    /**
+     * @brief A growable byte buffer with separate readable and writable regions
+     * @details Bytes are received into the view returned by Prepare(), made readable with 
+     *  Commit() and dropped from the front with Consume(). Readable bytes are only moved to the 
+     *  front of the storage when at least as many bytes have been consumed before them, so the 
+     *  cost of compaction is amortized over the consumed data. Otherwise storage is doubled.
+     */
+    class DynamicBuffer
+    {
+        std::unique_ptr<std::uint8_t[]> storage_;
+        std::size_t capacity_{};
+        std::size_t read_pos_{};  /* start of readable bytes */
+        std::size_t write_pos_{}; /* end of readable bytes, start of writable bytes */
+        std::size_t max_size_{kDynamicExtent};
+
+    public:
+        /**
+         * @brief Construct a new DynamicBuffer
+         * 
+         * @param max_size upper limit of the number of readable plus prepared bytes
+         * @param initial_capacity 
+         */
+        explicit DynamicBuffer(std::size_t max_size = kDynamicExtent, std::size_t initial_capacity = 0) noexcept
+            : max_size_{max_size}
+        {
+            if(initial_capacity > 0)
+                this->Reallocate(std::min(initial_capacity, max_size));
+        }
+
+        DynamicBuffer(DynamicBuffer const&) = delete;
+        DynamicBuffer& operator=(DynamicBuffer const&) = delete;
+        DynamicBuffer(DynamicBuffer&&) noexcept = default;
+        DynamicBuffer& operator=(DynamicBuffer&&) noexcept = default;
+        ~DynamicBuffer() noexcept = default;
+
+        /* Acquire pointer to start of readable bytes */
+        std::uint8_t* data() const noexcept { return this->storage_.get() + this->read_pos_; }
+
+        /* Acquire the number of readable bytes */
+        std::size_t size() const noexcept { return this->write_pos_ - this->read_pos_; }
+
+        std::size_t Capacity() const noexcept { return this->capacity_; }
+
+        std::size_t MaxSize() const noexcept { return this->max_size_; }
+
+        [[nodiscard]] bool Empty() const noexcept { return this->size() == 0; }
+
+        /* View of readable bytes */
+        ConstBufferView Data() const noexcept { return {this->data(), this->size()}; }
+
+        MutableBufferView MutableData() noexcept { return {this->data(), this->size()}; }
+
+        /**
+         * @brief Obtain writable space of at least min_size bytes after the readable bytes
+         * @details The whole writable region is returned so that a single receive may fill 
+         *  as much as the socket has available. Invalidates previously returned views.
+         * 
+         * @param min_size 
+         * @return MutableBufferView empty if min_size more bytes would exceed MaxSize()
+         */
+        [[nodiscard]] MutableBufferView Prepare(std::size_t min_size) noexcept
+        {
+            std::size_t const readable{this->size()};
+            if(min_size > this->max_size_ - readable) [[unlikely]] return {};
+
+            if(this->capacity_ - this->write_pos_ < min_size){
+                if(this->capacity_ - readable >= min_size && this->read_pos_ >= readable){
+                    this->Compact();
+                }else{
+                    std::size_t const doubled{this->capacity_ > this->max_size_ / 2 ? 
+                        this->max_size_ : this->capacity_ * 2};
+                    if(not this->Reallocate(std::max(readable + min_size, doubled))) [[unlikely]] return {};
+                }
+            }
+            return {this->storage_.get() + this->write_pos_, 
+                std::min(this->capacity_ - this->write_pos_, this->max_size_ - readable)};
+        }
+
+        /* Move n bytes from the front of the prepared (writable) region to the readable region */
+        void Commit(std::size_t n) noexcept
+        {
+            this->write_pos_ += std::min(n, this->capacity_ - this->write_pos_);
+        }
+
+        /* Drop n bytes from the front of the readable region */
+        void Consume(std::size_t n) noexcept
+        {
+            this->read_pos_ += std::min(n, this->size());
+            if(this->read_pos_ == this->write_pos_){ /* compacting an empty buffer is free */
+                this->read_pos_ = 0;
+                this->write_pos_ = 0;
+            }
+        }
+
+        void Clear() noexcept
+        {
+            this->read_pos_ = 0;
+            this->write_pos_ = 0;
+        }
+
+    private:
+        void Compact() noexcept
+        {
+            std::size_t const readable{this->size()};
+            std::memmove(this->storage_.get(), this->data(), readable);
+            this->read_pos_ = 0;
+            this->write_pos_ = readable;
+        }
+
+        bool Reallocate(std::size_t new_capacity) noexcept
+        {
+            std::unique_ptr<std::uint8_t[]> storage{new (std::nothrow) std::uint8_t[new_capacity]};
+            if(storage == nullptr) [[unlikely]] return false;
+
+            std::size_t const readable{this->size()};
+            if(readable > 0)
+                std::memcpy(storage.get(), this->data(), readable);
+            this->storage_ = std::move(storage);
+            this->capacity_ = new_capacity;
+            this->read_pos_ = 0;
+            this->write_pos_ = readable;
+            return true;
+        }
+    };
+
+    /**
+     * @brief Find the first occurrence of delimiter in buffer
+     * @details Vectorized with SSE2/AVX2 where the target supports it, see asrt::details::FindBytes()
+     * 
+     * @return std::size_t offset of the delimiter in buffer, kDynamicExtent if not found
+     */
+    [[nodiscard]] inline auto 
+    FindDelimiter(ConstBufferView buffer, std::string_view delimiter) noexcept -> std::size_t
+    {
+        std::size_t const pos{asrt::details::FindBytes(
+            static_cast<std::uint8_t const*>(buffer.data()), buffer.size(),
+            reinterpret_cast<std::uint8_t const*>(delimiter.data()), delimiter.size())};
+        return pos == asrt::details::kNoMatch ? kDynamicExtent : pos;
+    }
+
     [[nodiscard]] constexpr inline auto 
     make_buffer(void* data, std::size_t size) noexcept -> MutableBufferView
     {
@@ -421,5 +691,413 @@ namespace Buffer
         return {std_string_view.size() ? std_string_view.data() : nullptr,  std::min(max_size, std_string_view.size() * sizeof(T))};
     }
     
+    template <typename... BufferViews>
+        requires (sizeof...(BufferViews) <= kMaxBufferSequenceLength) &&
+            (std::is_convertible_v<BufferViews, MutableBufferView> && ...)
+    [[nodiscard]] inline auto 
+    make_buffer_sequence(BufferViews... views) noexcept -> MutableBufferSequence
+    {
+        return MutableBufferSequence{MutableBufferView{views}...};
+    }
+
+    template <typename... BufferViews>
+        requires (sizeof...(BufferViews) <= kMaxBufferSequenceLength) &&
+            (!(std::is_convertible_v<BufferViews, MutableBufferView> && ...)) &&
+            (std::is_convertible_v<BufferViews, ConstBufferView> && ...)
+    [[nodiscard]] inline auto 
+    make_buffer_sequence(BufferViews... views) noexcept -> ConstBufferSequence
+    {
+        return ConstBufferSequence{ConstBufferView{views}...};
+    }
+
+    class BufferPool;
+    class PooledBuffer;
+
+    namespace details{
+
+        /* block sizes handed out by BufferPool. larger requests are served from the heap */
+        inline constexpr std::array<std::size_t, 5> kPoolSizeClasses{256u, 1024u, 4096u, 16384u, 65536u};
+
+        /* number of free blocks of each size class a thread keeps to itself */
+        inline constexpr std::size_t kPoolThreadCacheDepth{32u};
+
+        /* number of pools a thread caches blocks of at the same time, eg: one per executor it runs */
+        inline constexpr std::size_t kPoolThreadCacheSlots{4u};
+
+        /* minimum size of the slab carved into blocks when a size class runs dry */
+        inline constexpr std::size_t kPoolSlabSize{256u * 1024u};
+
+        inline constexpr std::uint8_t kUnpooledSizeClass{0xFFu};
+
+        /* block header, immediately followed by the payload */
+        struct alignas(std::max_align_t) PooledBlock
+        {
+            std::atomic<std::uint32_t> refs_{};
+            std::uint8_t size_class_{kUnpooledSizeClass};
+            std::size_t size_{}; /* bytes in use */
+            std::size_t capacity_{};
+            BufferPool* pool_{nullptr};
+            PooledBlock* next_{nullptr}; /* free list link */
+
+            std::uint8_t* data() noexcept { return reinterpret_cast<std::uint8_t*>(this + 1); }
+        };
+
+        inline constexpr std::uint8_t ToSizeClass(std::size_t size) noexcept
+        {
+            for(std::uint8_t i{}; i < kPoolSizeClasses.size(); ++i){
+                if(size <= kPoolSizeClasses[i]) return i;
+            }
+            return kUnpooledSizeClass;
+        }
+
+        /* intrusive singly linked list of free blocks */
+        struct FreeList
+        {
+            PooledBlock* head_{nullptr};
+            std::size_t count_{};
+
+            void Push(PooledBlock* block) noexcept
+            {
+                block->next_ = std::exchange(this->head_, block);
+                ++this->count_;
+            }
+
+            PooledBlock* Pop() noexcept
+            {
+                PooledBlock* const block{this->head_};
+                if(block != nullptr){
+                    this->head_ = block->next_;
+                    --this->count_;
+                }
+                return block;
+            }
+
+            /* move up to n blocks to the front of other */
+            void Splice(FreeList& other, std::size_t n) noexcept
+            {
+                while(n-- > 0 && this->head_ != nullptr)
+                    other.Push(this->Pop());
+            }
+        };
+    }
+
+    /**
+     * @brief A reference counted view of a block of pooled memory
+     * @details Copies share the same block, which returns to its pool once the last copy 
+     *  is destroyed. The same received data may thereby be handed to a message handler and 
+     *  queued for any number of sends without being copied. size() is the number of bytes 
+     *  in use and may be changed with Resize() up to Capacity().
+     * 
+     * @warning A PooledBuffer must not outlive the BufferPool it was allocated from
+     */
+    class PooledBuffer
+    {
+        details::PooledBlock* block_{nullptr};
+
+        friend class BufferPool;
+        explicit PooledBuffer(details::PooledBlock* block) noexcept : block_{block} {}
+
+    public:
+        constexpr PooledBuffer() noexcept = default;
+
+        PooledBuffer(PooledBuffer const& other) noexcept : block_{other.block_}
+        {
+            if(this->block_ != nullptr) 
+                this->block_->refs_.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        PooledBuffer(PooledBuffer&& other) noexcept : block_{std::exchange(other.block_, nullptr)} {}
+
+        PooledBuffer& operator=(PooledBuffer const& other) noexcept
+        {
+            PooledBuffer{other}.Swap(*this);
+            return *this;
+        }
+
+        PooledBuffer& operator=(PooledBuffer&& other) noexcept
+        {
+            PooledBuffer{std::move(other)}.Swap(*this);
+            return *this;
+        }
+
+        ~PooledBuffer() noexcept { this->Reset(); }
+
+        void Swap(PooledBuffer& other) noexcept { std::swap(this->block_, other.block_); }
+
+        /* Drop this reference, recycling the block if it was the last one */
+        inline void Reset() noexcept;
+
+        /* Acquire pointer to start of underlying buffer */
+        std::uint8_t* data() const noexcept { return this->block_ ? this->block_->data() : nullptr; }
+
+        /* Acquire the number of bytes in use */
+        std::size_t size() const noexcept { return this->block_ ? this->block_->size_ : 0u; }
+
+        std::size_t Capacity() const noexcept { return this->block_ ? this->block_->capacity_ : 0u; }
+
+        [[nodiscard]] bool Empty() const noexcept { return this->size() == 0; }
+
+        /* Number of PooledBuffer instances sharing the block */
+        std::uint32_t UseCount() const noexcept 
+        { 
+            return this->block_ ? this->block_->refs_.load(std::memory_order_relaxed) : 0u; 
+        }
+
+        /**
+         * @brief Set the number of bytes in use
+         * 
+         * @param new_size 
+         * @return false if new_size exceeds Capacity()
+         */
+        [[nodiscard]] bool Resize(std::size_t new_size) noexcept
+        {
+            if(!this->block_) [[unlikely]] return new_size == 0u; /* empty or moved-from buffer */
+            if(new_size > this->Capacity()) [[unlikely]] return false;
+            this->block_->size_ = new_size;
+            return true;
+        }
+
+        /* View of the bytes in use */
+        ConstBufferView View() const noexcept { return {this->data(), this->size()}; }
+
+        /* View of the bytes in use. Writing through it is only safe while UseCount() == 1 */
+        MutableBufferView MutableView() noexcept { return {this->data(), this->size()}; }
+
+        /* View of the whole capacity, eg: as a receive buffer */
+        MutableBufferView CapacityView() noexcept { return {this->data(), this->Capacity()}; }
+
+        explicit operator bool() const noexcept { return this->block_ != nullptr; }
+
+        operator ConstBufferView() const noexcept { return this->View(); }
+    };
+
+    /**
+     * @brief Fixed size class slab allocator for network buffers
+     * @details Blocks are carved from slabs of kPoolSlabSize bytes and never returned to the 
+     *  system before the pool is destroyed. Each thread keeps a small cache of free blocks per 
+     *  size class so that most allocations and releases take no lock. Caches are refilled from 
+     *  and flushed to the shared free lists in batches of half the cache depth. A thread caches 
+     *  blocks of up to kPoolThreadCacheSlots pools at once, each identified by a process wide 
+     *  unique id so that a cache is never mistaken for that of a new pool at a reused address.
+     */
+    class BufferPool
+    {
+    public:
+        struct Statistics{
+            std::size_t slabs_{};
+            std::size_t slab_bytes_{};
+            std::size_t unpooled_allocations_{};
+        };
+
+        BufferPool() noexcept : id_{NextPoolId()}
+        {
+            std::scoped_lock const lock{Registry().mtx_};
+            Registry().live_pools_.push_back(this->id_);
+        }
+
+        BufferPool(BufferPool const&) = delete;
+        BufferPool& operator=(BufferPool const&) = delete;
+
+        /**
+         * @warning All buffers allocated from this pool must have been released
+         */
+        ~BufferPool() noexcept
+        {
+            {
+                /* blocks still held in thread caches die with the slabs, 
+                    the caches drop them once they find the id gone from the registry */
+                std::scoped_lock const lock{Registry().mtx_};
+                std::erase(Registry().live_pools_, this->id_);
+            }
+            for(void* slab : this->slabs_)
+                ::operator delete(slab);
+        }
+
+        /**
+         * @brief Obtain a buffer with at least size bytes of capacity
+         * 
+         * @param size number of bytes in use of the returned buffer
+         * @return PooledBuffer an empty buffer if memory is exhausted
+         */
+        PooledBuffer Allocate(std::size_t size) noexcept
+        {
+            std::uint8_t const size_class{details::ToSizeClass(size)};
+
+            details::PooledBlock* block{
+                size_class == details::kUnpooledSizeClass ? 
+                    this->AllocateUnpooled(size) : this->AllocatePooled(size_class)};
+
+            if(block == nullptr) [[unlikely]] return PooledBuffer{};
+
+            block->refs_.store(1u, std::memory_order_relaxed);
+            block->size_ = size;
+            return PooledBuffer{block};
+        }
+
+        Statistics GetStatistics() const noexcept
+        {
+            std::scoped_lock const lock{this->mtx_};
+            return this->stats_;
+        }
+
+    private:
+        friend class PooledBuffer;
+
+        /* free blocks a thread caches of one pool */
+        struct CacheSlot{
+            std::uint64_t pool_id_{0u}; /* 0 while unused */
+            BufferPool* pool_{nullptr}; /* only dereferenced while pool_id_ is found in the registry */
+            std::array<details::FreeList, details::kPoolSizeClasses.size()> lists_{};
+        };
+
+        struct ThreadCache{
+            std::array<CacheSlot, details::kPoolThreadCacheSlots> slots_{};
+            std::size_t next_victim_{}; /* slot to be reused next once all are taken */
+
+            ~ThreadCache() noexcept 
+            { 
+                for(CacheSlot& slot : this->slots_) 
+                    Flush(slot); 
+            }
+        };
+
+        /* ids of the pools alive in this process. guards thread cache flushes against destroyed pools */
+        struct PoolRegistry{
+            std::mutex mtx_;
+            std::vector<std::uint64_t> live_pools_;
+        };
+
+        static std::uint64_t NextPoolId() noexcept
+        {
+            static std::atomic<std::uint64_t> next_id{1u};
+            return next_id.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        static PoolRegistry& Registry() noexcept
+        {
+            static PoolRegistry registry;
+            return registry;
+        }
+
+        static ThreadCache& LocalCache() noexcept
+        {
+            thread_local ThreadCache cache;
+            return cache;
+        }
+
+        /* hand the blocks of a cache slot back to their pool, unless the pool is gone */
+        static void Flush(CacheSlot& slot) noexcept
+        {
+            if(slot.pool_id_ == 0u) return;
+
+            std::scoped_lock const registry_lock{Registry().mtx_};
+            if(std::ranges::find(Registry().live_pools_, slot.pool_id_) != Registry().live_pools_.end()){
+                std::scoped_lock const lock{slot.pool_->mtx_};
+                for(std::size_t i{}; i < slot.lists_.size(); ++i)
+                    slot.lists_[i].Splice(slot.pool_->free_lists_[i], slot.lists_[i].count_);
+            }
+            slot = CacheSlot{};
+        }
+
+        /* the calling thread's cache of this pool, taking over a free or the least recently taken slot */
+        CacheSlot& AcquireCache() noexcept
+        {
+            ThreadCache& cache{LocalCache()};
+            for(CacheSlot& slot : cache.slots_){
+                if(slot.pool_id_ == this->id_) [[likely]] return slot;
+            }
+
+            auto const free_slot{std::ranges::find(cache.slots_, 0u, &CacheSlot::pool_id_)};
+            CacheSlot& slot{free_slot != cache.slots_.end() ? 
+                *free_slot : cache.slots_[cache.next_victim_++ % cache.slots_.size()]};
+            Flush(slot);
+            slot.pool_id_ = this->id_;
+            slot.pool_ = this;
+            return slot;
+        }
+
+        details::PooledBlock* AllocatePooled(std::uint8_t size_class) noexcept
+        {
+            details::FreeList& local{this->AcquireCache().lists_[size_class]};
+
+            if(local.head_ == nullptr) [[unlikely]] {
+                std::scoped_lock const lock{this->mtx_};
+                details::FreeList& shared{this->free_lists_[size_class]};
+                if(shared.head_ == nullptr){
+                    this->CarveSlab(size_class, shared);
+                }
+                shared.Splice(local, details::kPoolThreadCacheDepth / 2);
+            }
+            return local.Pop();
+        }
+
+        details::PooledBlock* AllocateUnpooled(std::size_t size) noexcept
+        {
+            void* const memory{::operator new(sizeof(details::PooledBlock) + size, std::nothrow)};
+            if(memory == nullptr) [[unlikely]] return nullptr;
+
+            auto* const block{::new (memory) details::PooledBlock{}};
+            block->capacity_ = size;
+            block->pool_ = this;
+
+            std::scoped_lock const lock{this->mtx_};
+            ++this->stats_.unpooled_allocations_;
+            return block;
+        }
+
+        /* split a new slab into blocks of the given size class. mtx_ must be held */
+        void CarveSlab(std::uint8_t size_class, details::FreeList& list) noexcept
+        {
+            std::size_t const stride{sizeof(details::PooledBlock) + details::kPoolSizeClasses[size_class]};
+            std::size_t const count{std::max(details::kPoolThreadCacheDepth, details::kPoolSlabSize / stride)};
+
+            void* const slab{::operator new(stride * count, std::nothrow)};
+            if(slab == nullptr) [[unlikely]] return;
+            this->slabs_.push_back(slab);
+            ++this->stats_.slabs_;
+            this->stats_.slab_bytes_ += stride * count;
+
+            for(std::size_t i{}; i < count; ++i){
+                auto* const block{::new (static_cast<std::uint8_t*>(slab) + i * stride) details::PooledBlock{}};
+                block->size_class_ = size_class;
+                block->capacity_ = details::kPoolSizeClasses[size_class];
+                block->pool_ = this;
+                list.Push(block);
+            }
+        }
+
+        void Release(details::PooledBlock* block) noexcept
+        {
+            if(block->size_class_ == details::kUnpooledSizeClass) [[unlikely]] {
+                block->~PooledBlock();
+                ::operator delete(block);
+                return;
+            }
+
+            details::FreeList& local{this->AcquireCache().lists_[block->size_class_]};
+            local.Push(block);
+
+            if(local.count_ > details::kPoolThreadCacheDepth) [[unlikely]] {
+                std::scoped_lock const lock{this->mtx_};
+                local.Splice(this->free_lists_[block->size_class_], details::kPoolThreadCacheDepth / 2);
+            }
+        }
+
+        const std::uint64_t id_;
+        mutable std::mutex mtx_; /* protects free_lists_, slabs_ and stats_ */
+        std::array<details::FreeList, details::kPoolSizeClasses.size()> free_lists_{};
+        std::vector<void*> slabs_;
+        Statistics stats_{};
+    };
+
+    inline void PooledBuffer::Reset() noexcept
+    {
+        if(this->block_ != nullptr){
+            details::PooledBlock* const block{std::exchange(this->block_, nullptr)};
+            if(block->refs_.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                block->pool_->Release(block);
+        }
+    }
+
 }
 #endif /* F1D7D7CD_EB59_43F9_82D7_24F129C87BB5 */
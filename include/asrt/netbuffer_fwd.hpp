@@ -1,9 +1,15 @@
 #ifndef F46A4A4C_D7FD_4C08_A97F_AEACA38C938D
 #define F46A4A4C_D7FD_4C08_A97F_AEACA38C938D
 
+#include <cstddef>
+
 namespace Buffer{
     class MutableBufferView;
     class ConstBufferView;
+    class PooledBuffer;
+    class BufferPool;
+    template <typename BufferView, std::size_t MaxBuffers>
+    class BasicBufferSequence;
 }
 
 #endif /* F46A4A4C_D7FD_4C08_A97F_AEACA38C938D */
@@ -7,6 +7,8 @@
 #include <mutex>
 //#include <shared_mutex>
 #include <vector>
+#include <array>
+#include <algorithm>
 #include <limits>
 #include <queue>
 //#include <bitset>
@@ -30,8 +32,19 @@ namespace ReactorNS{
 
     namespace internal{
         static constexpr HandlerTag kReactorUnblockTag{std::numeric_limits<HandlerTag>::max()};
-        static constexpr HandlerTag kTimerTag{std::numeric_limits<HandlerTag>::max() - 1};
-        static constexpr HandlerTag kMaxHandlerCount{std::numeric_limits<HandlerTag>::max() - 2};
+        static constexpr HandlerTag kMaxTimerHandlerCount{ExecutorNS::kMaxTimerShards}; /* one per timer queue shard */
+        static constexpr HandlerTag kTimerTag{std::numeric_limits<HandlerTag>::max() - 1}; /* subsequent timer tags count downwards */
+        static constexpr HandlerTag kMaxHandlerCount{kTimerTag - kMaxTimerHandlerCount};
+
+        constexpr bool IsTimerTag(HandlerTag tag) noexcept
+        {
+            return (tag <= kTimerTag) && (tag > kMaxHandlerCount);
+        }
+
+        constexpr std::size_t ToTimerIndex(HandlerTag tag) noexcept
+        {
+            return kTimerTag - tag;
+        }
 
         struct HandlerTagInfo {
             using size_type = HandlerTag;
@@ -147,10 +160,23 @@ namespace ReactorNS{
 
             /**
              * @brief indicates whether the handler is pending execution; flag is reset before handler invocation
+             * @details one executor job is held for all pending operations of the io source together
              * @note  unused by software events
              */
             bool async_operation_ongoing_;
 
+            /**
+             * @brief operations (read, write and/or error) started and not yet served by a handler invocation
+             * @note  unused by software events
+             */
+            Events pending_operations_{};
+
+            /**
+             * @brief pending operations that the handler invocation in progress was called for
+             * @note  unused by software events
+             */
+            Events served_operations_{};
+
             /**
              * @brief whether the handler is still registered
              * 
@@ -188,6 +214,12 @@ namespace ReactorNS{
              * 
              */
             bool close_io_source_{false};
+
+            /**
+             * @brief io source detached, the handler and this entry are kept for the next io source of its owner
+             * 
+             */
+            bool reserved_{false};
         };
 #if 0        
         constexpr std::size_t a = sizeof(OperationEntry);
@@ -196,8 +228,10 @@ namespace ReactorNS{
 #endif
 
         struct TimerOperation{
+            MutexType mtx_; /* handed out to the timer queue that owns this entry */
             asrt::NativeHandle timer_fd_{asrt::kInvalidNativeHandle};
             TimerHandler handler_;
+            bool registered_{false};
             bool in_progress_{false};
             bool release_handler_memory_{false};
         };
@@ -266,14 +300,17 @@ namespace ReactorNS{
                 });
             }
 
-            /* remove timer fd from epoll interest list */
-            if(asrt::IsFdValid(this->timer_op_.timer_fd_)){
-                this->epoll_.Remove(this->timer_op_.timer_fd_)
-                .map_error([](ErrorCode ec){
-                    ASRT_LOG_ERROR(
-                        "[EpollReactor]: Failed to un-register timer fd during reactor deconstruction: {}", ec);
+            /* remove timer fds from epoll interest list */
+            std::for_each(this->timer_ops_.begin(), this->timer_ops_.end(),
+                [this](auto& timer_op){
+                    if(timer_op.registered_ && asrt::IsFdValid(timer_op.timer_fd_)){
+                        this->epoll_.Remove(timer_op.timer_fd_)
+                        .map_error([](ErrorCode ec){
+                            ASRT_LOG_ERROR(
+                                "[EpollReactor]: Failed to un-register timer fd during reactor deconstruction: {}", ec);
+                        });
+                    }
                 });
-            }
 
             /* close epoll fd */
             this->epoll_.Close();
@@ -397,8 +434,9 @@ namespace ReactorNS{
             using enum EventRegistrationType;
             if constexpr (RegType == kIoEvent) {
                 if(events.HasIoEvent()) {
-                    /* eager registration for read events */
-                    monitored_events.Add(EPOLLIN | EPOLLPRI); //todo check epollpri meaning 
+                    /* eager registration for read events. 
+                        EPOLLEXCLUSIVE may only be combined with EPOLLIN, EPOLLOUT, EPOLLET and EPOLLWAKEUP */
+                    monitored_events.Add(events.IsExclusive() ? EPOLLIN : EPOLLIN | EPOLLPRI); //todo check epollpri meaning 
 
                     /* register i/o event with epoll */
                     Result<void> const add_event_result{
@@ -418,6 +456,7 @@ namespace ReactorNS{
             it->valid_ = true;
             it->monitored_events_ = monitored_events;
             it->captured_events_ = {};
+            it->pending_operations_ = {};
             it->handler_posted_ = false;
 
             ASRT_LOG_TRACE("[EpollReactor]: Registered event {:#x} for fd {} at index {}",
@@ -435,6 +474,15 @@ namespace ReactorNS{
             const auto io_source{entry_to_deregister.io_source_};
             ASRT_LOG_DEBUG("[EpollReactor]: Deregistering io source {}", io_source);
 
+            if(entry_to_deregister.reserved_) { /* detached, its io source is already closed */
+                if(not entry_to_deregister.execution_in_progress_)
+                    temp_handler = std::move(entry_to_deregister.handler_);
+                else
+                    entry_to_deregister.release_handler_memory_ = true;
+                entry_to_deregister.reserved_ = false;
+                return Result<void>{};
+            }
+
             if(!entry_to_deregister.valid_) [[unlikely]] { /* entry already deregistered */
                 ASRT_LOG_ERROR("[EpollReactor]: IO source already deregistered.");
                 return MakeUnexpected(ErrorCode::reactor_entry_invalid);
@@ -475,6 +523,72 @@ namespace ReactorNS{
                 });
         }
 
+        auto DetachImpl(HandlerTag tag) noexcept -> Result<void>
+        {
+            auto& entry_to_detach{this->operations_[tag]};
+
+            std::scoped_lock const lock{entry_to_detach.mtx_};
+            const auto io_source{entry_to_detach.io_source_};
+            ASRT_LOG_DEBUG("[EpollReactor]: Detaching io source {}", io_source);
+
+            if(!entry_to_detach.valid_) [[unlikely]] {
+                ASRT_LOG_ERROR("[EpollReactor]: IO source already deregistered.");
+                return MakeUnexpected(ErrorCode::reactor_entry_invalid);
+            }
+
+            if(not entry_to_detach.execution_in_progress_){
+                /* closing the last descriptor of the io source drops it from the interest list */
+                static_cast<void>(OsAbstraction::Close(io_source)
+                    .map_error([io_source](ErrorCode ec){
+                        ASRT_LOG_ERROR("[EpollReactor]: Failed to close io source {}, {}", io_source, ec);
+                        return ec;
+                    }));
+            }else{ /* closed once the handler in progress returns */
+                entry_to_detach.close_io_source_ = true;
+            }
+
+            /* readiness of the old io source must not be reported to the next one */
+            entry_to_detach.monitored_events_ = {};
+            entry_to_detach.captured_events_ = {};
+            entry_to_detach.pending_operations_ = {};
+            entry_to_detach.valid_ = false;
+            entry_to_detach.reserved_ = true;
+            return Result<void>{};
+        }
+
+        auto ReassignImpl(HandlerTag tag, asrt::NativeHandle io_source, Events events) noexcept -> Result<void>
+        {
+            auto& entry{this->operations_[tag]};
+
+            std::scoped_lock const lock{entry.mtx_};
+            ASRT_LOG_DEBUG("[EpollReactor]: Reassigning entry {} to fd {}", tag, io_source);
+
+            if(!entry.reserved_) [[unlikely]] {
+                ASRT_LOG_ERROR("[EpollReactor]: Entry {} was not detached.", tag);
+                return MakeUnexpected(ErrorCode::reactor_entry_invalid);
+            }
+
+            if(entry.execution_in_progress_) [[unlikely]] { /* still serving the previous io source */
+                return MakeUnexpected(ErrorCode::async_operation_in_progress);
+            }
+
+            Events monitored_events{events};
+            monitored_events.Add(events.IsExclusive() ? EPOLLIN : EPOLLIN | EPOLLPRI);
+
+            return this->epoll_.Add(io_source, this->MakeEpollStruct(monitored_events, tag))
+                .map([io_source, monitored_events, &entry](){
+                    entry.io_source_ = io_source;
+                    entry.monitored_events_ = monitored_events;
+                    entry.captured_events_ = {};
+                    entry.valid_ = true;
+                    entry.reserved_ = false;
+                })
+                .map_error([](ErrorCode ec){
+                    ASRT_LOG_ERROR("[EpollReactor]: Add entry fail, {}", ec);
+                    return ec;
+                });
+        }
+
         Result<void> TriggerSoftwareEvent(HandlerTag tag) noexcept
         {
             //todo check tag is software tag
@@ -545,20 +659,26 @@ namespace ReactorNS{
                 return UnblockReason::kTimeout;
             }
 
+            bool unblocked{false};
             for(unsigned int index = 0; index < num_io_events; index++){
                 ::epoll_event const event{this->epoll_events_[index]}; /* get received events */
                 //todo: add tag validation
                 HandlerTag const tag{static_cast<HandlerTag>(event.data.u32)};
                 if(tag == internal::kReactorUnblockTag){
+                    /* keep going, the timerfds are edge-triggered and their events are not reported again */
                     this->HandleUnblock();
-                    return UnblockReason::kUnblocked;
-                }else if(tag == internal::kTimerTag) {
-                    this->HandleTimerEvent(op_queue);
+                    unblocked = true;
+                }else if(internal::IsTimerTag(tag)) {
+                    this->HandleTimerEvent(tag, op_queue);
                 }else{
                     this->HandleSingleEvent(event, tag, op_queue);
                 }
             }
 
+            if(unblocked){
+                ASRT_LOG_TRACE("UnblockReason::kUnblocked!");
+                return UnblockReason::kUnblocked;
+            }
             ASRT_LOG_TRACE("UnblockReason::kEventsHandled!");
             return UnblockReason::kEventsHandled;
         }
@@ -616,9 +736,11 @@ namespace ReactorNS{
 
         /**
          * @brief update monitiored i/o event; notify executor of incoming job
+         * @details kError subscribes to error queue readiness. epoll always reports EPOLLERR, 
+         *  so unlike kWrite it only has to be added to the monitored events.
          * 
          * @param tag 
-         * @param op_type read and/or write
+         * @param op_type read, write and/or error
          */
         void OnStartOfOperation(HandlerTag tag, OperationType op_type) noexcept
         {
@@ -634,6 +756,7 @@ namespace ReactorNS{
                 !operation.monitored_events_.HasWriteEvent()};
 
             operation.monitored_events_ += op_type; //todo this is confusing why are we adding event type to op type?
+            operation.pending_operations_ += op_type;
 
             ASRT_LOG_TRACE("Reactor OnStartOfOperation() updated monitored events {}({:#x})",
                 operation.monitored_events_,
@@ -648,7 +771,11 @@ namespace ReactorNS{
                     along with previously requested event so we don't call OnJobArrival() here */
                 ASRT_LOG_TRACE("Io source {}", operation.io_source_, " async in progress");
             }
-            if(update_epoll) [[unlikely]] {
+            if(update_epoll && operation.monitored_events_.IsExclusive()) [[unlikely]] {
+                /* EPOLL_CTL_MOD is rejected for exclusive registrations */
+                ASRT_LOG_ERROR("Io source {} registered for exclusive wakeup cannot monitor write events",
+                    operation.io_source_);
+            }else if(update_epoll) [[unlikely]] {
                 ASRT_LOG_TRACE("Updating epoll to monitor write event for io source {}, monitored events {:#x}",
                     operation.io_source_, operation.monitored_events_.ExtractEpollEvent());
                 this->epoll_.Modify(operation.io_source_, 
@@ -672,34 +799,41 @@ namespace ReactorNS{
 
             /* ignored events are not considered consumed 
                 therefore we resubscribe them */
-            this->operations_[tag].monitored_events_ += ev;
+            auto& operation{this->operations_[tag]};
+            operation.monitored_events_ += ev;
 
-            /* the event that was dispatched to io objects was unhandled
-                therefore we initiate a complementary OnJobArrival() call 
-                to indicate to the executor that the job remains outstanding */
-            this->executor_.OnJobArrival(); 
+            /* an operation the event was reported for remains outstanding. 
+                the job accounting is settled once the handler returns */
+            operation.pending_operations_ += ev.Intersection(operation.served_operations_);
         }
 
         /**
          * @brief A private timer handler registration method used by friend class TimerQueue
          *          to bypass certain precondition checks
-         * @return Returns API_Error if user tries to re-register timer handler through this API
+         * @details Each registered timer handler (ie: timer queue shard) gets its own tag and mutex 
+         *          so that shards do not contend with each other
+         * @return Returns capacity_exceeded if all timer handler slots are taken
          */
         template <typename TimerHandler>
         Result<ReactorRegistry> RegisterTimerHandlerImpl(asrt::NativeHandle timerfd, TimerHandler&& handler) noexcept
         {
-            std::scoped_lock const lock{this->timer_mtx_};
-            return this->CheckTimerHandlerNotExist()
-                .and_then([this, timerfd](){
+            std::scoped_lock const lock{this->timer_registration_mtx_};
+            return this->GetNextAvailableTimerTag()
+                .and_then([this, timerfd](HandlerTag tag) -> Result<HandlerTag> {
+                    /* edge-triggered: every (re)arm of the timerfd yields exactly one event, so the reactor 
+                        does not keep reporting a timerfd whose expiry is still being handled */
                     auto epoll_event{
-                        this->MakeEpollStruct(Events::EventType::kRead, internal::kTimerTag)}; /* level-triggered */
-                    return this->epoll_.Add(timerfd, epoll_event);
+                        this->MakeEpollStruct(Events::EventType::kReadEdge, tag)};
+                    return this->epoll_.Add(timerfd, epoll_event)
+                        .map([tag](){ return tag; });
                 }) 
-                .map([this, timerfd, &handler](){
-                    this->timer_op_.timer_fd_ = timerfd;
-                    this->timer_op_.handler_ = std::move(handler);
-                    this->has_timer_handler_ = true;
-                    return ReactorRegistry{internal::kTimerTag, this->timer_mtx_};
+                .map([this, timerfd, &handler](HandlerTag tag){
+                    auto& timer_op{this->timer_ops_[internal::ToTimerIndex(tag)]};
+                    std::scoped_lock const op_lock{timer_op.mtx_};
+                    timer_op.timer_fd_ = timerfd;
+                    timer_op.handler_ = std::move(handler);
+                    timer_op.registered_ = true;
+                    return ReactorRegistry{tag, timer_op.mtx_};
                 })
                 .map_error([this](ErrorCode ec){
                     ASRT_LOG_ERROR(
@@ -710,24 +844,27 @@ namespace ReactorNS{
 
         void DeregisterTimerHandlerImpl(HandlerTag tag) noexcept
         {
-            assert(tag == internal::kTimerTag); //todo we might need multiple timer tags in the future
+            assert(internal::IsTimerTag(tag));
 
             TimerHandler placeholder{};
-            std::scoped_lock const lock{this->timer_mtx_};
+            auto& timer_op{this->timer_ops_[internal::ToTimerIndex(tag)]};
+            std::scoped_lock const lock{this->timer_registration_mtx_, timer_op.mtx_};
             
-            if(!this->timer_op_.in_progress_){
+            if(!timer_op.in_progress_){
 
-                placeholder = std::move(this->timer_op_.handler_);
+                placeholder = std::move(timer_op.handler_);
 
-                OsAbstraction::Close(this->timer_op_.timer_fd_)
+                OsAbstraction::Close(timer_op.timer_fd_)
                 .map_error([](ErrorCode ec){
                     ASRT_LOG_ERROR("[EpollReactor]: Failed to close timer fd, {}", ec);
                 });
 
+                timer_op.timer_fd_ = asrt::kInvalidNativeHandle;
+                timer_op.registered_ = false;
                 ASRT_LOG_TRACE("Closed timer fd and released handler");
 
             }else{ /* handler is mid execution */
-                this->timer_op_.release_handler_memory_ = true;
+                timer_op.release_handler_memory_ = true;
                 ASRT_LOG_TRACE("Closing timer fd and releasing handler asynchronously");
             }
         }
@@ -737,11 +874,20 @@ namespace ReactorNS{
         using OperationIterator = typename OperationStorage::iterator;
         using EventStorage = std::vector<::epoll_event>;
 
-        constexpr Result<void> CheckTimerHandlerNotExist() noexcept
+        /* assumes timer registration lock held */
+        Result<HandlerTag> GetNextAvailableTimerTag() const noexcept
         {
-            return this->has_timer_handler_ ? 
-                MakeUnexpected(ErrorCode::api_error) :
-                Result<void>{};
+            const auto free_slot{std::find_if(this->timer_ops_.begin(), this->timer_ops_.end(),
+                [](const auto& timer_op){
+                    return !timer_op.registered_;
+                })};
+
+            if(free_slot == this->timer_ops_.end()) [[unlikely]] {
+                return MakeUnexpected(ErrorCode::capacity_exceeded);
+            }
+
+            return static_cast<HandlerTag>(
+                internal::kTimerTag - std::distance(this->timer_ops_.begin(), free_slot));
         }
 
         auto MakeIoEventOpertaionHandler(HandlerTag handler_tag) noexcept {
@@ -771,6 +917,11 @@ namespace ReactorNS{
                             user needs to re-register for i/o events prior to next operation */
                         op.monitored_events_.Consume(events_to_report); 
 
+                        /* the job held for the pending operations is completed by this invocation */
+                        const bool job_held{op.async_operation_ongoing_};
+                        op.served_operations_ = op.pending_operations_.Intersection(events_to_report);
+                        op.pending_operations_.Consume(events_to_report);
+
                         /* mark async phase finished so that next incoming operation 
                             will get a separate executor job */
                         op.async_operation_ongoing_ = false;
@@ -783,6 +934,20 @@ namespace ReactorNS{
                         assert(operation_lock.owns_lock());
 
                         op.execution_in_progress_ = false;
+                        op.served_operations_ = {};
+
+                        /* operations this invocation was not called for (eg: a send still waiting for 
+                            writability after a read event) are still pending and need a job of their own */
+                        if(!op.async_operation_ongoing_ && op.pending_operations_.HasAnyEvents()) [[unlikely]] {
+                            op.async_operation_ongoing_ = true;
+                            this->executor_.OnJobArrival();
+                        }
+
+                        /* events no operation was pending for (eg: eager read registration) 
+                            still complete a job once the invocation returns */
+                        if(!job_held) [[unlikely]] {
+                            this->executor_.OnJobArrival();
+                        }
                     }else [[unlikely]] {
                         /* events monitored removed by io object */
                         ASRT_LOG_DEBUG("User removed registered event for io source {}. Skipping handler.", 
@@ -853,22 +1018,23 @@ namespace ReactorNS{
             };
         }
 
-        void HandleTimerEvent(OperationQueue& op_queue) noexcept 
+        void HandleTimerEvent(HandlerTag tag, OperationQueue& op_queue) noexcept 
         {   
-            ASRT_LOG_TRACE("Handling timer event");
-            op_queue.push_back([this](){               
-                std::unique_lock<MutexType> lock{this->timer_mtx_};
-                this->timer_op_.in_progress_ = true;
+            ASRT_LOG_TRACE("Handling timer event {:#x}", tag);
+            op_queue.push_back([this, tag](){
+                auto& timer_op{this->timer_ops_[internal::ToTimerIndex(tag)]};
+                std::unique_lock<MutexType> lock{timer_op.mtx_};
+                timer_op.in_progress_ = true;
 
                 ASRT_LOG_TRACE("Calling timer operation handler");
 
-                this->timer_op_.handler_(internal::kTimerTag, lock);
+                timer_op.handler_(tag, lock);
 
                 TimerHandler placeholder{};
-                if(this->timer_op_.release_handler_memory_){
-                    placeholder = std::move(this->timer_op_.handler_);
+                if(timer_op.release_handler_memory_){
+                    placeholder = std::move(timer_op.handler_);
                 }
-                this->timer_op_.in_progress_ = false;
+                timer_op.in_progress_ = false;
             });
 
             ASRT_LOG_TRACE("Enqueued timer event handler");
@@ -990,7 +1156,7 @@ namespace ReactorNS{
                 {/* enter critical section */
                     std::scoped_lock operation_lock{it->mtx_};
 
-                    if(!it->valid_){ /* already deregistered */
+                    if(!it->valid_ && !it->reserved_){ /* already deregistered */
                         if(!it->handler_posted_){ /* safe to enqueue here */
                             if(!found_slot){
                                 found_slot = true;
@@ -1002,8 +1168,8 @@ namespace ReactorNS{
                         }else{ /* deregistered but handler still in use */
                             last_used_entry = it; /* entry still in use */
                         }
-                    }else{ /* entry still registered */
-                        if(it->io_source_ == io_source) [[unlikely]] {
+                    }else{ /* entry still registered or reserved */
+                        if(it->valid_ && it->io_source_ == io_source) [[unlikely]] {
                             ASRT_LOG_TRACE("fd {} already registered!", io_source);
                             /* we want an early exit since registration has already failed at this point */
                             return MakeUnexpected(ErrorCode::api_error); //todo: alrady registered
@@ -1065,6 +1231,12 @@ namespace ReactorNS{
                 return Result<void>{};
             }
 
+            if(monitored_events.IsExclusive()) [[unlikely]] {
+                ASRT_LOG_ERROR("[EpollReactor]: Cannot {} event for io source {} registered for exclusive wakeup",
+                    kChangeTypePrintable[ChangeHow], entry.io_source_);
+                return MakeUnexpected(ErrorCode::invalid_argument);
+            }
+
             return this->epoll_.Modify(entry.io_source_, 
                 MakeEpollStruct((changed_event.ExtractEpollEvent() | EPOLLIN | EPOLLPRI), tag))
                 .map([&entry, changed_event](){
@@ -1097,9 +1269,8 @@ namespace ReactorNS{
         OperationStorage operations_;
         MutexType software_events_mtx_;
         std::vector<HandlerTag> triggered_software_events_;
-        MutexType timer_mtx_;
-        TimerOperation timer_op_; /* proteced by timer_mtx_ */
-        bool has_timer_handler_{false};
+        MutexType timer_registration_mtx_;
+        std::array<TimerOperation, internal::kMaxTimerHandlerCount> timer_ops_; /* each entry protected by its own mutex */
 
         //bool do_release_handler_memory_{false};
 
@@ -91,6 +91,24 @@ namespace ReactorNS
         */
         auto Deregister(HandlerTag tag, bool close_on_deregister) -> Expected<void, ErrorCode>;
 
+        /*!
+        * \brief    Closes the io source of a registered handler, keeping the handler and its slot for Reassign()
+        *
+        * \details  Closing the io source drops it from the interest list, so unlike Deregister() this costs no 
+        *           epoll_ctl(). The io source must not have been duplicated (eg: by dup() or fork()) since the kernel 
+        *           only forgets it once all of its descriptors are closed. Deregister() releases a detached slot.
+        * \param    tag handler id returned by Register() 
+        */
+        auto Detach(HandlerTag tag) -> Expected<void, ErrorCode>;
+
+        /*!
+        * \brief    Registers a new io source with the handler kept by Detach()
+        *
+        * \details  Skips the search for a free slot and the re-allocation of the handler a Register() would do
+        * \return   async_operation_in_progress if the handler is still running for the previous io source
+        */
+        auto Reassign(HandlerTag tag, asrt::NativeHandle fd, Events ev) noexcept -> Expected<void, ErrorCode>;
+
         template<typename EventHandler>
         auto UpdateRegisteredHandler(HandlerTag tag, EventHandler &&handler) noexcept -> Expected<void, ErrorCode>;
 
@@ -155,6 +173,20 @@ namespace ReactorNS
     }
 
 
+    template <typename ReactorImpl>
+    inline auto ReactorInterface<ReactorImpl>::
+    Detach(HandlerTag tag) -> Expected<void, ErrorCode>
+    {
+        return Implementation().DetachImpl(tag);
+    }
+
+    template <typename ReactorImpl>
+    inline auto ReactorInterface<ReactorImpl>::
+    Reassign(HandlerTag tag, asrt::NativeHandle fd, Events ev) noexcept -> Expected<void, ErrorCode>
+    {
+        return Implementation().ReassignImpl(tag, fd, ev);
+    }
+
     template <typename ReactorImpl>
     template <typename EventHandler>
     inline auto ReactorInterface<ReactorImpl>::
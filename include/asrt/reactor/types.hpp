@@ -49,7 +49,9 @@ using EpollEventType = decltype(::epoll_event::events);
             kReadErr = ::EPOLL_EVENTS::EPOLLIN | ::EPOLL_EVENTS::EPOLLERR,
             kWriteErr = ::EPOLL_EVENTS::EPOLLOUT | ::EPOLL_EVENTS::EPOLLERR,
             kError = ::EPOLL_EVENTS::EPOLLERR,
-            kHangup = ::EPOLL_EVENTS::EPOLLHUP
+            kHangup = ::EPOLL_EVENTS::EPOLLHUP,
+            kExclusive = ::EPOLL_EVENTS::EPOLLEXCLUSIVE,
+            kReadEdgeExclusive = ::EPOLL_EVENTS::EPOLLIN | ::EPOLL_EVENTS::EPOLLET | ::EPOLL_EVENTS::EPOLLEXCLUSIVE
         };
 
         inline auto ToString(const EventType event_type) -> std::string
@@ -117,6 +119,12 @@ using EpollEventType = decltype(::epoll_event::events);
                 case EventType::kWriteErr:
                     printable = "WriteError";
                     break;      
+                case EventType::kExclusive:
+                    printable = "Exclusive";
+                    break;
+                case EventType::kReadEdgeExclusive:
+                    printable = "Read,Edge,Exclusive";
+                    break;
                 default:
                     printable = "Unrecognized";
                     break;
@@ -252,8 +260,16 @@ using EpollEventType = decltype(::epoll_event::events);
 
         constexpr bool HasWriteEvent() const noexcept { return this->HasEvent(EventType::kWrite); }
 
+        constexpr bool HasErrorEvent() const noexcept { return this->HasEvent(EventType::kError); }
+
         constexpr bool HasIoEvent() const noexcept { return this->HasReadEvent() || this->HasWriteEvent(); }
 
+        /**
+         * @brief Whether the io source is registered for exclusive wakeup (EPOLLEXCLUSIVE), ie: an event 
+         *  wakes up only one of the epoll instances monitoring the io source instead of all of them
+         */
+        constexpr bool IsExclusive() const noexcept { return this->HasEvent(EventType::kExclusive); }
+
         constexpr auto GetIoEvents() const noexcept -> Events
         {
             return Events{this->event_mask_ & (EPOLLIN | EPOLLOUT)};
@@ -2,33 +2,202 @@
 #define E3B889E7_19D1_4B9E_A316_46EDA641E7A9
 
 #include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include <algorithm>
 #include <new>
 #include <atomic>
+#include <bit>
+#include <limits>
+#include <utility>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "asrt/common_types.hpp"
+#include "asrt/error_code.hpp"
+#include "asrt/netbuffer.hpp"
+#include "asrt/sys/syscall.hpp"
+#include "asrt/util.hpp"
 
 namespace asrt{
 
 namespace details{
 
-#ifdef __cpp_lib_hardware_interference_size
-    static constexpr auto kCacheAlign{std::hardware_destructive_interference_size};
-#else
+    /* not std::hardware_destructive_interference_size, which varies with -mtune and would change the class layout */
     static constexpr std::size_t kCacheAlign{64u};
-#endif
 
 }
 
+/**
+ * @brief Single producer single consumer byte ring whose storage is mapped twice back-to-back
+ * @details The same memfd backed pages are mapped at [base, base + capacity) and again at
+ *  [base + capacity, base + 2 * capacity). Any span of up to Capacity() bytes starting inside
+ *  the ring is therefore contiguous in virtual memory, even across wraparound. The producer
+ *  may receive straight into Prepare() and the consumer parses Data() in place, a frame
+ *  split by the end of the ring never has to be copied together.
+ *
+ * @note Prepare()/Commit() may only be called by the producer thread and Data()/Consume()
+ *  only by the consumer thread. The capacity is rounded up to a power of two multiple of the page size.
+ */
 class RingBufferView{
 
 public:
-    RingBufferView() noexcept = default;
+    using Index = std::uint32_t;
+    static constexpr std::size_t kMaxCapacity{std::size_t{1u} << 31u}; /* free running indices must wrap at a multiple of the capacity */
+
+    /**
+     * @brief Create a ring holding at least min_capacity bytes
+     *
+     * @param min_capacity
+     * @return Result<RingBufferView> invalid_argument if min_capacity exceeds kMaxCapacity
+     */
+    [[nodiscard]] static auto Create(std::size_t min_capacity) noexcept -> Result<RingBufferView>
+    {
+        using namespace Util::Expected_NS;
+
+        std::size_t const page_size{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+        if(min_capacity > kMaxCapacity) [[unlikely]]
+            return MakeUnexpected(ErrorCodeType::invalid_argument);
+
+        std::size_t const capacity{std::bit_ceil(std::max(min_capacity, page_size))};
+
+        return OsAbstraction::MemfdCreate("asrt_ring")
+            .and_then([capacity](int fd) -> Result<std::uint8_t*> {
+                auto mapping{OsAbstraction::FileTruncate(fd, static_cast<::off_t>(capacity))
+                    .and_then([fd, capacity](){ return MapMirrored(fd, capacity); })};
+                static_cast<void>(OsAbstraction::Close(fd)); /* the mappings keep the file alive */
+                return mapping;
+            })
+            .map([capacity](std::uint8_t* base){
+                return RingBufferView{base, capacity};
+            });
+    }
+
+    RingBufferView(RingBufferView const&) = delete;
+    RingBufferView& operator=(RingBufferView const&) = delete;
+
+    /* movable so that Create() can return it, not while in use */
+    RingBufferView(RingBufferView&& other) noexcept
+        : base_{std::exchange(other.base_, nullptr)}, capacity_{std::exchange(other.capacity_, 0u)}
+    {
+        this->head_index_.store(other.head_index_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        this->tail_index_.store(other.tail_index_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    RingBufferView& operator=(RingBufferView&& other) noexcept
+    {
+        if(this != &other){
+            this->Unmap();
+            this->base_ = std::exchange(other.base_, nullptr);
+            this->capacity_ = std::exchange(other.capacity_, 0u);
+            this->head_index_.store(other.head_index_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            this->tail_index_.store(other.tail_index_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    ~RingBufferView() noexcept
+    {
+        this->Unmap();
+    }
 
+    /**
+     * @brief [Producer] The contiguous free space of the ring, to be followed by Commit()
+     */
+    [[nodiscard]] Buffer::MutableBufferView Prepare() noexcept
+    {
+        Index const tail{this->tail_index_.load(std::memory_order_relaxed)};
+        Index const head{this->head_index_.load(std::memory_order_acquire)};
+        return {this->base_ + this->Offset(tail), this->capacity_ - static_cast<Index>(tail - head)};
+    }
+
+    /**
+     * @brief [Producer] Publish n bytes written to the space returned by Prepare()
+     */
+    void Commit(std::size_t n) noexcept
+    {
+        Index const tail{this->tail_index_.load(std::memory_order_relaxed)};
+        assert(n <= this->capacity_ - static_cast<Index>(tail - this->head_index_.load(std::memory_order_acquire)));
+        this->tail_index_.store(static_cast<Index>(tail + n), std::memory_order_release);
+    }
+
+    /**
+     * @brief [Consumer] The contiguous readable bytes of the ring
+     */
+    [[nodiscard]] Buffer::ConstBufferView Data() noexcept
+    {
+        Index const head{this->head_index_.load(std::memory_order_relaxed)};
+        Index const tail{this->tail_index_.load(std::memory_order_acquire)};
+        return {this->base_ + this->Offset(head), static_cast<Index>(tail - head)};
+    }
+
+    /**
+     * @brief [Consumer] Release n bytes returned by Data() back to the producer
+     */
+    void Consume(std::size_t n) noexcept
+    {
+        Index const head{this->head_index_.load(std::memory_order_relaxed)};
+        assert(n <= static_cast<Index>(this->tail_index_.load(std::memory_order_acquire) - head));
+        this->head_index_.store(static_cast<Index>(head + n), std::memory_order_release);
+    }
+
+    /**
+     * @brief Number of readable bytes. Exact only when called by either side while the other is idle.
+     */
+    std::size_t size() const noexcept
+    {
+        return static_cast<Index>(
+            this->tail_index_.load(std::memory_order_acquire) - this->head_index_.load(std::memory_order_acquire));
+    }
+
+    bool Empty() const noexcept { return this->size() == 0; }
+
+    std::size_t Capacity() const noexcept { return this->capacity_; }
 
 private:
+    RingBufferView(std::uint8_t* base, std::size_t capacity) noexcept
+        : base_{base}, capacity_{capacity} {}
+
+    /**
+     * @brief Map the first capacity bytes of fd twice in a row into a reserved address range
+     */
+    static auto MapMirrored(int fd, std::size_t capacity) noexcept -> Result<std::uint8_t*>
+    {
+        return OsAbstraction::MemoryMap(nullptr, 2 * capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+            .and_then([fd, capacity](void* reserved) -> Result<std::uint8_t*> {
+                auto* base{static_cast<std::uint8_t*>(reserved)};
+                auto const map_half{[fd, capacity](std::uint8_t* addr){
+                    return OsAbstraction::MemoryMap(addr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+                }};
+                return map_half(base)
+                    .and_then([&](void*){ return map_half(base + capacity); })
+                    .map([base](void*){ return base; })
+                    .map_error([base, capacity](ErrorCodeType ec){
+                        static_cast<void>(OsAbstraction::MemoryUnmap(base, 2 * capacity));
+                        return ec;
+                    });
+            });
+    }
+
+    std::size_t Offset(Index index) const noexcept
+    {
+        return index & (this->capacity_ - 1u);
+    }
+
+    void Unmap() noexcept
+    {
+        if(this->base_ != nullptr){
+            static_cast<void>(OsAbstraction::MemoryUnmap(this->base_, 2 * this->capacity_));
+            this->base_ = nullptr;
+        }
+    }
 
-    
+    std::uint8_t* base_{nullptr};
+    std::size_t capacity_{0u};
 
-    alignas(details::kCacheAlign) std::atomic<std::uint32_t> head_index_;
-    alignas(details::kCacheAlign) std::atomic<std::uint32_t> tail_index_;
+    /* free running, written by the consumer and producer respectively */
+    alignas(details::kCacheAlign) std::atomic<Index> head_index_{0u};
+    alignas(details::kCacheAlign) std::atomic<Index> tail_index_{0u};
 };
 
 
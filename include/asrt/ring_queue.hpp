@@ -0,0 +1,193 @@
+#ifndef C2E85F4A_7B19_4D63_9A0E_3F6D81B5C7A2
+#define C2E85F4A_7B19_4D63_9A0E_3F6D81B5C7A2
+
+#include <cstddef>
+#include <cassert>
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace asrt{
+
+namespace details{
+
+    static constexpr std::size_t kRingQueueInitialCapacity{16u};
+
+}
+
+/**
+ * @brief A FIFO queue over a single growable ring of elements
+ * @details Unlike std::deque, which allocates a new chunk whenever the back crosses a chunk boundary
+ *  and frees the front chunk once it drains, the ring keeps its storage for as long as the queue lives.
+ *  It only allocates when it outgrows its capacity, which is then doubled. A queue that is filled and
+ *  drained over and over (eg: the executor operation queue) therefore stops allocating once it has
+ *  seen its largest backlog. clear() destroys the elements but keeps the storage as well.
+ *
+ * @tparam T must be nothrow move constructible
+ * @note Not thread safe.
+ */
+template <typename T>
+class RingQueue
+{
+    static_assert(std::is_nothrow_move_constructible_v<T>, "Elements are relocated on growth");
+
+public:
+    using value_type        = T;
+    using size_type         = std::size_t;
+    using reference         = T&;
+    using const_reference   = T const&;
+
+    template <bool IsConst>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IsConst, T const*, T*>;
+        using reference         = std::conditional_t<IsConst, T const&, T&>;
+        using Queue             = std::conditional_t<IsConst, RingQueue const, RingQueue>;
+
+        Iterator() noexcept = default;
+        Iterator(Queue* queue, size_type position) noexcept : queue_{queue}, position_{position} {}
+
+        reference operator*() const noexcept { return this->queue_->At(this->position_); }
+        pointer operator->() const noexcept { return &this->queue_->At(this->position_); }
+        Iterator& operator++() noexcept { ++this->position_; return *this; }
+        Iterator operator++(int) noexcept { Iterator prev{*this}; ++this->position_; return prev; }
+        bool operator==(Iterator const& other) const noexcept { return this->position_ == other.position_; }
+
+    private:
+        Queue* queue_{nullptr};
+        size_type position_{0u}; /* offset from the front */
+    };
+
+    using iterator          = Iterator<false>;
+    using const_iterator    = Iterator<true>;
+
+    RingQueue() noexcept = default;
+
+    RingQueue(RingQueue const&) = delete;
+    RingQueue &operator=(RingQueue const &other) = delete;
+
+    RingQueue(RingQueue&& other) noexcept
+        : slots_{std::exchange(other.slots_, nullptr)},
+          capacity_{std::exchange(other.capacity_, 0u)},
+          head_{std::exchange(other.head_, 0u)},
+          size_{std::exchange(other.size_, 0u)} {}
+
+    RingQueue &operator=(RingQueue &&other) noexcept
+    {
+        if(this != &other){
+            this->Release();
+            this->slots_ = std::exchange(other.slots_, nullptr);
+            this->capacity_ = std::exchange(other.capacity_, 0u);
+            this->head_ = std::exchange(other.head_, 0u);
+            this->size_ = std::exchange(other.size_, 0u);
+        }
+        return *this;
+    }
+
+    ~RingQueue() noexcept
+    {
+        this->Release();
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if(this->size_ == this->capacity_) [[unlikely]] {
+            this->Grow();
+        }
+        T* const slot{std::construct_at(this->Slot(this->size_), std::forward<Args>(args)...)};
+        ++this->size_;
+        return *slot;
+    }
+
+    void push_back(T&& value) { (void)this->emplace_back(std::move(value)); }
+
+    void pop_front() noexcept
+    {
+        assert(!this->empty());
+        std::destroy_at(this->Slot(0u));
+        this->head_ = (this->head_ + 1u) & (this->capacity_ - 1u);
+        --this->size_;
+    }
+
+    reference front() noexcept { assert(!this->empty()); return *this->Slot(0u); }
+    const_reference front() const noexcept { assert(!this->empty()); return *this->Slot(0u); }
+
+    /**
+     * @brief Destroy all elements, the storage is kept for reuse
+     */
+    void clear() noexcept
+    {
+        while(!this->empty()){
+            this->pop_front();
+        }
+        this->head_ = 0u;
+    }
+
+    bool empty() const noexcept { return this->size_ == 0u; }
+    size_type size() const noexcept { return this->size_; }
+    size_type capacity() const noexcept { return this->capacity_; }
+
+    iterator begin() noexcept { return iterator{this, 0u}; }
+    iterator end() noexcept { return iterator{this, this->size_}; }
+    const_iterator begin() const noexcept { return const_iterator{this, 0u}; }
+    const_iterator end() const noexcept { return const_iterator{this, this->size_}; }
+
+private:
+    /* capacity_ is zero or a power of two */
+    T* Slot(size_type position) const noexcept
+    {
+        return this->slots_ + ((this->head_ + position) & (this->capacity_ - 1u));
+    }
+
+    T& At(size_type position) const noexcept
+    {
+        return *this->Slot(position);
+    }
+
+    void Grow()
+    {
+        const size_type new_capacity{this->capacity_ ?
+            this->capacity_ * 2u : std::bit_ceil(details::kRingQueueInitialCapacity)};
+        T* const new_slots{std::allocator<T>{}.allocate(new_capacity)};
+
+        /* relocate to the start of the new ring so that the front is at index 0 */
+        for(size_type position{0u}; position < this->size_; ++position){
+            T* const old_slot{this->Slot(position)};
+            std::construct_at(new_slots + position, std::move(*old_slot));
+            std::destroy_at(old_slot);
+        }
+
+        if(this->slots_ != nullptr){
+            std::allocator<T>{}.deallocate(this->slots_, this->capacity_);
+        }
+        this->slots_ = new_slots;
+        this->capacity_ = new_capacity;
+        this->head_ = 0u;
+    }
+
+    void Release() noexcept
+    {
+        this->clear();
+        if(this->slots_ != nullptr){
+            std::allocator<T>{}.deallocate(this->slots_, this->capacity_);
+            this->slots_ = nullptr;
+            this->capacity_ = 0u;
+        }
+    }
+
+    T* slots_{nullptr};
+    size_type capacity_{0u};
+    size_type head_{0u};
+    size_type size_{0u};
+};
+
+} // end ns asrt
+
+#endif /* C2E85F4A_7B19_4D63_9A0E_3F6D81B5C7A2 */
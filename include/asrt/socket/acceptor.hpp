@@ -2,6 +2,8 @@
 #define BB654D12_3FB5_46D6_A4B0_F42DC3240883
 
 #include <cstdint>
+#include <cstddef>
+#include <functional>
 
 #include "asrt/common_types.hpp"
 #include "asrt/util.hpp"
@@ -23,6 +25,9 @@ namespace details
     static_assert(kDefaultListenConnections < SocketBase::kMaxListenConnections, 
         "default max connection backlog execeeded");
 
+    /* connections accepted per readiness notification before yielding to other executor work */
+    static constexpr std::size_t kDefaultAcceptBudget{64u};
+
     enum class AcceptorSocketState : std::uint8_t
     {
         kDisconnected,
@@ -96,13 +101,22 @@ public:
     };
 
     using AcceptCompletionHandler = std::function<void(Result<void>&&)>;
+    using AcceptLoopHandler = std::function<void(Result<NativeHandleType>&&)>;
 
+    /* may be combined, eg: kReuseAddress | kReusePort */
     enum class AcceptorOptions : std::uint8_t
     {
-        kNone,
-        kReuseAddress
+        kNone = 0x00u,
+        kReuseAddress = 0x01u,
+        kReusePort = 0x02u, /* SO_REUSEPORT, lets several acceptors bind one endpoint */
+        kExclusiveWakeup = 0x04u /* EPOLLEXCLUSIVE, a connection request wakes one of the executors sharing the listening socket */
     };
 
+    friend constexpr AcceptorOptions operator|(AcceptorOptions lhs, AcceptorOptions rhs) noexcept
+    {
+        return static_cast<AcceptorOptions>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+    }
+
     /* @brief A default constructed socket can NOT perform socket operations without first being Open()ed
        @brief A default constructed socket can NOT perform asynchronous socket operations
     */
@@ -111,6 +125,20 @@ public:
     //explicit BasicAcceptorSocket(Reactor& reactor) noexcept : Base(reactor) {};
     BasicAcceptorSocket(Executor& executor, const BoundEndpointType& endpoint, 
         AcceptorOptions options = AcceptorOptions::kReuseAddress) noexcept;
+
+    /**
+     * @brief Construct an acceptor from a socket that is already listening, eg: inherited across fork() 
+     *  or dup()ed so that several executors accept from the same pending connection queue
+     * @details Use AcceptorOptions::kExclusiveWakeup so that each connection request wakes only one of them.
+     *  Aborts if the socket cannot be registered with the executor.
+     * 
+     * @param executor 
+     * @param protocol the protocol the socket was opened with
+     * @param listening_handle a bound, listening socket. Ownership is transferred to the acceptor.
+     * @param options only kExclusiveWakeup applies, the socket is already bound
+     */
+    BasicAcceptorSocket(Executor& executor, const Protocol& protocol, NativeHandleType listening_handle,
+        AcceptorOptions options = AcceptorOptions::kNone) noexcept;
     BasicAcceptorSocket(BasicAcceptorSocket const&) = delete;
     BasicAcceptorSocket(BasicAcceptorSocket&& other) noexcept;
     BasicAcceptorSocket &operator=(BasicAcceptorSocket const &other) = delete;
@@ -122,6 +150,13 @@ public:
 
     auto Listen(void) noexcept -> Result<void>;
 
+    /**
+     * @brief Set the length of the pending connection queue used once the acceptor starts listening
+     * 
+     * @param backlog capped by the kernel at /proc/sys/net/core/somaxconn
+     */
+    void SetListenBacklog(int backlog) noexcept { this->listen_backlog_ = backlog; }
+
     auto Accept(AcceptedSocketType& peer_socket) noexcept -> Result<void>;
 
     auto Accept(AcceptedSocketType& peer_socket, AcceptedEndpointType& peer_endpoint) noexcept -> Result<void>;
@@ -139,6 +174,40 @@ public:
         AcceptedEndpointType& peer_endpoint, 
         AcceptCompletionCallback&& accept_handler) noexcept -> Result<void>;
 
+    /**
+     * @brief Accept connections continuously until stopped
+     * @details On every readiness notification connections are accepted until the pending connection 
+     *  queue is drained (EAGAIN) or the budget is spent, in which case the remainder is accepted in a 
+     *  subsequent executor job so that other work is not starved. The handler is passed the handle of 
+     *  each accepted (non-blocking) socket which is typically handed to AssignAcceptedHandle(). 
+     *  An accept error other than EAGAIN (eg: emfile) is passed to the handler, the loop then 
+     *  waits for the next connection request instead of retrying right away.
+     * 
+     * @tparam AcceptLoopCallback void(Result<NativeHandleType>&&)
+     * @param accept_handler invoked in executor context once per accepted connection
+     * @param budget maximum number of connections accepted per executor job
+     * @return Result<void> accept_operation_ongoing if an accept is already in progress
+     */
+    template <typename AcceptLoopCallback>
+    auto AcceptLoopAsync(
+        AcceptLoopCallback&& accept_handler, 
+        std::size_t budget = Socket::details::kDefaultAcceptBudget) noexcept -> Result<void>;
+
+    /**
+     * @brief End an accept loop started with AcceptLoopAsync(). May be called from within the handler.
+     * 
+     */
+    void StopAcceptLoop() noexcept;
+
+    /**
+     * @brief Take ownership of a socket handle passed to the accept loop handler
+     * 
+     * @param peer_socket a not-open socket
+     * @param handle accepted socket handle, closed if it cannot be assigned
+     * @return Result<void> 
+     */
+    auto AssignAcceptedHandle(AcceptedSocketType& peer_socket, NativeHandleType handle) noexcept -> Result<void>;
+
     void OnReactorEventImpl(Events events, std::unique_lock<MutexType>& lock) noexcept;
 
     Result<void> BindToEndpointImpl(const AcceptedEndpointType& ep) noexcept;
@@ -161,6 +230,11 @@ public:
  
 private:
 
+    static constexpr bool HasOption(AcceptorOptions options, AcceptorOptions option) noexcept
+    {
+        return (static_cast<std::uint8_t>(options) & static_cast<std::uint8_t>(option)) != 0u;
+    }
+
     Result<void> AcceptSyncInternal(AcceptedSocketType& peer_socket, AcceptedEndpointType* peer_endpoint) noexcept;
     
     template <typename AcceptCompletionCallback>
@@ -180,11 +254,20 @@ private:
 
     void HandleAysncAccept(std::unique_lock<MutexType>& lock) noexcept;
 
+    void HandleAcceptLoop(std::unique_lock<MutexType>& lock) noexcept;
+
+    void ContinueAcceptLoop() noexcept;
+
     AcceptorSocketState acceptor_sockstate_{AcceptorSocketState::kDisconnected};
     AcceptCompletionHandler on_accept_complete_{};
+    AcceptLoopHandler on_accept_loop_{};
     AcceptedSocketType* peer_socket_{nullptr};
     AcceptedEndpointType* peer_info_{nullptr};
+    std::size_t accept_budget_{Socket::details::kDefaultAcceptBudget};
+    int listen_backlog_{Socket::details::kDefaultListenConnections};
+    std::uint32_t accept_loop_generation_{0u};
     bool speculative_accept_{false};
+    bool accept_loop_{false};
 };
 
 template <typename Protocol, class Executor>
@@ -214,6 +297,47 @@ AcceptAsync(
     return this->AcceptAsyncInternal(peer_socket, &peer_endpoint, std::move(accept_handler));
 }
 
+template <typename Protocol, class Executor>
+template <typename AcceptLoopCallback>
+inline auto BasicAcceptorSocket<Protocol, Executor>::
+AcceptLoopAsync(AcceptLoopCallback&& accept_handler, std::size_t budget) noexcept -> Result<void>
+{
+    std::scoped_lock const lock{Base::GetMutexUnsafe()};
+
+    assert(Base::IsAsyncPreconditionsMet());
+
+    Result<void> const listen_result{
+        this->acceptor_sockstate_ == AcceptorSocketState::kBound ? 
+            this->DoListen() : Result<void>{}};
+
+    if(!listen_result.has_value()) [[unlikely]]
+        return listen_result;
+
+    switch(this->acceptor_sockstate_)
+    {
+        [[likely]] case AcceptorSocketState::kListening:
+            break;
+        [[unlikely]] case AcceptorSocketState::kAccepting:
+            return MakeUnexpected(SockErrorCode::accept_operation_ongoing);
+        [[unlikely]] case AcceptorSocketState::kDisconnected:
+            return MakeUnexpected(SockErrorCode::socket_not_bound);
+        [[unlikely]] default:
+            return MakeUnexpected(SockErrorCode::api_error);
+    }
+
+    ASRT_LOG_TRACE("[Acceptor]: Started accept loop with budget {}", budget);
+    this->SetAcceptorSocketState(AcceptorSocketState::kAccepting);
+    this->on_accept_loop_ = std::forward<AcceptLoopCallback>(accept_handler);
+    this->accept_budget_ = budget == 0u ? 1u : budget;
+    this->accept_loop_ = true;
+    ++this->accept_loop_generation_;
+    this->speculative_accept_ = false;
+
+    /* readiness is edge triggered, drain whatever is already queued before waiting for the next edge */
+    Base::PostImmediateExecutorJob([this](){ this->ContinueAcceptLoop(); });
+    return Result<void>{};
+}
+
 template <typename Protocol, class Executor>
 template <typename AcceptCompletionCallback>
 inline void BasicAcceptorSocket<Protocol, Executor>::
@@ -222,33 +346,24 @@ DoAsyncAccept(
     AcceptedEndpointType* peer_endpoint, 
     AcceptCompletionCallback&& callback) noexcept
 {
-    bool async_needed{false};
-    Result<void> accept_result;
-
-    if(this->speculative_accept_) [[unlikely]] {
-        ASRT_LOG_TRACE("Speculative accept");
-        accept_result = this->DoAccept(peer_socket, peer_endpoint);
-        if(!accept_result.has_value() && 
-            ErrorCode_Ns::IsBusy(accept_result.error())) [[unlikely]] {
-                async_needed = true;
-        }
+    this->peer_socket_ = &peer_socket;
+    this->peer_info_ = peer_endpoint;
+    this->on_accept_complete_ = std::move(callback);
+
+    if(this->speculative_accept_) {
+        /* more connections are likely queued behind the last readiness edge, which will not be reported again. 
+            the accept is deferred to an executor job since registering the accepted socket with the reactor 
+            must not happen while holding the acceptor lock */
+        ASRT_LOG_TRACE("[Acceptor]: Speculative accept");
         this->speculative_accept_ = false;
+        Base::PostImmediateExecutorJob([this](){
+            std::unique_lock<MutexType> lock{Base::GetMutexUnsafe()};
+            if(this->acceptor_sockstate_ == AcceptorSocketState::kAccepting && !this->accept_loop_) [[likely]]
+                this->HandleAysncAccept(lock);
+        });
     }else [[likely]] {
-        async_needed = true;
-    }
-
-    if(async_needed) [[likely]] {
-        this->peer_socket_ = &peer_socket;
-        this->peer_info_ = peer_endpoint;
-        this->on_accept_complete_ = std::move(callback);
         ASRT_LOG_TRACE("[Acceptor]: Started async accept");
         Base::AsyncReadOperationStarted(); 
-    }else{
-        ASRT_LOG_TRACE("Posting accept handler for immediate completion.");
-        Base::PostImmediateExecutorJob(
-            [callback = std::move(callback), result = std::move(accept_result)]() mutable {
-                callback(std::move(result));
-            });
     }
 }
 
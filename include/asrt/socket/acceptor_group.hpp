@@ -0,0 +1,150 @@
+#ifndef A41F6C2E_7D35_4E0B_9B6A_2C8F13D5E907
+#define A41F6C2E_7D35_4E0B_9B6A_2C8F13D5E907
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <memory>
+#include <vector>
+#include <linux/filter.h>
+
+#include "asrt/common_types.hpp"
+#include "asrt/error_code.hpp"
+#include "asrt/socket/acceptor.hpp"
+#include "asrt/socket/socket_option.hpp"
+#include "asrt/type_traits.hpp"
+#include "asrt/util.hpp"
+
+namespace Socket{
+
+using namespace Util::Expected_NS;
+using asrt::Result;
+
+/**
+ * @brief Classic BPF program selecting the listener of a SO_REUSEPORT group by the cpu that
+ *  received the connection request: index = cpu % group size
+ */
+struct ReusePortCpuSteering :
+    SockOption::SocketOption<ReusePortCpuSteering, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF>
+{
+    explicit ReusePortCpuSteering(std::uint32_t group_size) noexcept
+        : filter_{{
+            {BPF_LD  | BPF_W   | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+            {BPF_ALU | BPF_MOD | BPF_K,   0, 0, group_size},
+            {BPF_RET | BPF_A,             0, 0, 0}
+          }} {}
+
+    constexpr std::size_t Length() const noexcept {return sizeof(::sock_fprog);}
+    /* the program is referenced by pointer, rebuild it so that copies stay valid */
+    auto data() const noexcept
+    {
+        this->fprog_.len = static_cast<unsigned short>(this->filter_.size());
+        this->fprog_.filter = const_cast<::sock_filter*>(this->filter_.data());
+        return &this->fprog_;
+    }
+private:
+    std::array<::sock_filter, 3> filter_;
+    mutable ::sock_fprog fprog_{};
+};
+
+/**
+ * @brief A set of acceptors listening on the same endpoint through SO_REUSEPORT, one per shard
+ * @details Each shard is an independent listener with its own accept queue, served by the executor it
+ *  was added with, so accepting scales with the number of shards instead of funneling every connection
+ *  through one socket. The kernel hashes connection requests onto the shards unless cpu steering is
+ *  attached, in which case a request is accepted by shard (cpu % shards) where cpu is the one that
+ *  received it. Pin the thread running the executor of shard i to cpu i so that accepted
+ *  connections are served on the core their packets already arrive on.
+ *
+ * @tparam Protocol an internet stream protocol, eg: Tcp
+ * @tparam Executor
+ */
+template <typename Protocol, class Executor>
+class ReusePortAcceptorGroup{
+    static_assert(ProtocolTraits::is_internet_domain<Protocol>::value, "SO_REUSEPORT applies to internet domain sockets only!");
+public:
+    using Acceptor = BasicAcceptorSocket<Protocol, Executor>;
+    using Endpoint = typename Protocol::Endpoint;
+
+    explicit ReusePortAcceptorGroup(const Endpoint& endpoint) noexcept
+        : endpoint_{endpoint} {}
+
+    ReusePortAcceptorGroup(ReusePortAcceptorGroup const&) = delete;
+    ReusePortAcceptorGroup(ReusePortAcceptorGroup&&) = delete;
+    ReusePortAcceptorGroup& operator=(ReusePortAcceptorGroup const&) = delete;
+    ReusePortAcceptorGroup& operator=(ReusePortAcceptorGroup&&) = delete;
+    ~ReusePortAcceptorGroup() noexcept = default;
+
+    /**
+     * @brief Add a listener bound to the group endpoint whose asynchronous accepts complete on executor
+     * @details Aborts if the endpoint cannot be bound, as the acceptor constructor does.
+     *  All shards must be added before Listen().
+     *
+     * @param executor
+     * @return Acceptor& the shard, eg: to start an accept loop on
+     */
+    Acceptor& AddShard(Executor& executor) noexcept
+    {
+        Acceptor& acceptor{*this->shards_.emplace_back(
+            std::make_unique<Acceptor>(executor, this->endpoint_, 
+                Acceptor::AcceptorOptions::kReuseAddress | Acceptor::AcceptorOptions::kReusePort))};
+
+        /* the first shard resolves an ephemeral port, the others must join it on the same port */
+        if(this->shards_.size() == 1u)
+            this->endpoint_ = acceptor.GetLocalEndpoint();
+
+        return acceptor;
+    }
+
+    /**
+     * @brief Start listening on all shards, in the order they were added
+     * @details The kernel indexes the reuseport group by the order its sockets start listening,
+     *  which is what cpu steering relies on to map cpu i to shard i.
+     *
+     * @param backlog pending connection queue length of each shard
+     * @return Result<void>
+     */
+    auto Listen(int backlog = Socket::details::kDefaultListenConnections) noexcept -> Result<void>
+    {
+        for(auto& shard : this->shards_){
+            shard->SetListenBacklog(backlog);
+            Result<void> const listen_result{shard->Listen()};
+            if(!listen_result.has_value()) [[unlikely]]
+                return listen_result;
+        }
+        return Result<void>{};
+    }
+
+    /**
+     * @brief Steer connection requests to the shard matching the cpu that received them
+     * @note Call after Listen(). Requires a kernel with SO_ATTACH_REUSEPORT_CBPF (linux 4.5+).
+     *
+     * @return Result<void> api_error if the group has no shards
+     */
+    auto AttachCpuSteering() noexcept -> Result<void>
+    {
+        if(this->shards_.empty()) [[unlikely]]
+            return MakeUnexpected(asrt::ErrorCodeType::api_error);
+
+        /* the program is shared by the whole group, attaching it to any member is sufficient */
+        return this->shards_.front()->SetOption(
+            ReusePortCpuSteering{static_cast<std::uint32_t>(this->shards_.size())});
+    }
+
+    std::size_t Size() const noexcept { return this->shards_.size(); }
+
+    Acceptor& Shard(std::size_t index) noexcept { return *this->shards_[index]; }
+
+    /**
+     * @brief The endpoint shared by all shards, with the port resolved once the first shard is added
+     */
+    const Endpoint& GetEndpoint() const noexcept { return this->endpoint_; }
+
+private:
+    Endpoint endpoint_;
+    std::vector<std::unique_ptr<Acceptor>> shards_;
+};
+
+} //end ns Socket
+
+#endif /* A41F6C2E_7D35_4E0B_9B6A_2C8F13D5E907 */
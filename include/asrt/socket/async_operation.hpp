@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <utility>
 #include <functional>
+#include <type_traits>
 #include <spdlog/fmt/bin_to_hex.h>
 
 #include "asrt/util.hpp"
@@ -37,6 +38,8 @@ namespace Socket{
         typename CompletionHandler>
     class AsyncOperation{
     public:  
+        using BufferViewType = BufferView;
+
         AsyncOperation() noexcept = default;
 
         static constexpr const char* OperationTypeStr() noexcept
@@ -45,6 +48,12 @@ namespace Socket{
                 return "send";
             else if constexpr (OperationType::kReceive == OpType)
                 return "receive";
+            else if constexpr (OperationType::kSendFile == OpType)
+                return "send file";
+            else if constexpr (OperationType::kSpliceReceive == OpType)
+                return "splice receive";
+            else if constexpr (OperationType::kSpliceSend == OpType)
+                return "splice send";
             else
                 return "connect";
         }
@@ -81,7 +90,7 @@ namespace Socket{
          * 
          * @tparam CompletionCallback void(Result&&)
          * @tparam OnImmediateCompletion void(Callback&&, Result&&)
-         * @param op_mode kSpeculative and/or kExhaustive
+         * @param op_mode kSpeculative and/or kExhaustive, sends may add kZeroCopy
          * @param buff_view buffer view associated with the i/o operation
          * @param user_callback handler to be posted after successful i/o
          * @param on_immediate routine to be invoked if speculative i/o is successful
@@ -93,7 +102,7 @@ namespace Socket{
         OperationStatus Perform(
             asrt::NativeHandle native_handle,
             int op_mode,
-            BufferView buff_view,
+            BufferView const& buff_view,
             CompletionCallback&& user_callback,
             OnImmediateCompletion&& on_immediate) noexcept
         {
@@ -101,6 +110,13 @@ namespace Socket{
             const bool is_exhaustive{bool(op_mode & kExhaustive)};
             const bool allow_speculative{bool(op_mode & kSpeculative)};
 
+            if constexpr (OpType == OperationType::kSend) {
+                if(!this->opeartion_ongoing_) [[likely]] {
+                    this->zero_copy_ = bool(op_mode & kZeroCopy);
+                    this->zero_copy_sends_ = 0;
+                }
+            }
+
             if(!allow_speculative){
                 this->OnInitiation(std::move(user_callback), buff_view, is_exhaustive, 0);
                 return OperationStatus::kAsyncNeeded;
@@ -122,11 +138,18 @@ namespace Socket{
 
         bool IsOngoing() const {return this->opeartion_ongoing_;}
 
+        /**
+         * @brief Number of MSG_ZEROCOPY send calls made by the current (or last) operation that sent data
+         * @details Each of them is acknowledged by a separate completion on the socket error queue 
+         */
+        std::uint32_t ZeroCopySends() const noexcept {return this->zero_copy_sends_;}
+
         void Reset() noexcept
         {
             this->total_bytes_ = 0;
             this->opeartion_ongoing_ = false;
             this->is_exhaustive_ = false;
+            this->zero_copy_ = false;
             this->buffer_view_ = {};
             this->completetion_handler_ = {};
             this->completion_result_ = {};
@@ -134,9 +157,17 @@ namespace Socket{
 
     private:
 
+        /* scatter/gather operations resume partial i/o across view boundaries via BufferView::Advance() */
+        static constexpr bool kIsBufferSequence{BufferViewTraits::is_sequence<BufferView>::value};
+        /* file and pipe transfers have no user space buffer at all */
+        static constexpr bool kIsKernelTransfer{
+            std::is_same_v<BufferView, Socket::Types::FileRegion> || std::is_same_v<BufferView, Socket::Types::PipeRegion>};
+
         std::size_t total_bytes_{};
         bool opeartion_ongoing_{false};
         bool is_exhaustive_{false};
+        bool zero_copy_{false};
+        std::uint32_t zero_copy_sends_{};
         
         BufferView buffer_view_;
         CompletionHandler completetion_handler_{};
@@ -172,7 +203,7 @@ namespace Socket{
         template <typename CompletionCallback>
         void OnInitiation(
             CompletionCallback&& user_callback, 
-            BufferView buff_view, 
+            BufferView const& buff_view, 
             bool is_exhaustive, 
             std::size_t bytes_handled) noexcept
         {
@@ -203,7 +234,7 @@ namespace Socket{
 
         PerformResult DoPerform(
             asrt::NativeHandle native_handle, 
-            BufferView buffer_view,
+            BufferView const& buffer_view,
             bool is_exhaustive,
             OperationContext op_context = kInitiation) noexcept
         {
@@ -262,20 +293,68 @@ namespace Socket{
                 }
             }else{
                 /* async send/recv opeartion */
-                if constexpr (OpType == OperationType::kReceive) {
+                if constexpr (OpType == OperationType::kReceive || kIsKernelTransfer) {
                     if(buffer_view.size() == 0) [[unlikely]] { /* zero-byte receives on stream sockets are no-ops */
-                        ASRT_LOG_WARN("Requested to read async zero-bytes on sockfd {}", native_handle);
+                        ASRT_LOG_WARN("Requested to {} async zero-bytes on sockfd {}", OperationTypeStr(), native_handle);
                         completion_result_.emplace();
                         return {OperationStatus::kComplete, 0};
                     }    
                 }
 
-                /* perform native i/o */
+                /* perform native i/o. buffer sequences go through a single vectored syscall */
                 Result<std::size_t> io_result;
+                [[maybe_unused]] bool end_of_file{false}; /* the sent file or pipe ran dry before the region did */
                 if constexpr (OpType == OperationType::kSend) {
-                    io_result = OsAbstraction::NonBlockingSend(native_handle, buffer_view);
+                    if(this->zero_copy_) [[unlikely]] {
+                        int const zero_copy_flags{MSG_DONTWAIT | MSG_NOSIGNAL | MSG_ZEROCOPY};
+                        if constexpr (kIsBufferSequence)
+                            io_result = OsAbstraction::SendVectored(native_handle, buffer_view, zero_copy_flags);
+                        else
+                            io_result = OsAbstraction::Send(native_handle, buffer_view, zero_copy_flags);
+
+                        if(io_result.has_value()) [[likely]] {
+                            if(io_result.value() > 0) ++this->zero_copy_sends_;
+                        }else if(io_result.error() == SockErrorCode::no_buffer_space) {
+                            /* too many unacknowledged zero-copy sends pinned; copy this chunk instead */
+                            if constexpr (kIsBufferSequence)
+                                io_result = OsAbstraction::SendVectored(native_handle, buffer_view, MSG_DONTWAIT | MSG_NOSIGNAL);
+                            else
+                                io_result = OsAbstraction::Send(native_handle, buffer_view, MSG_DONTWAIT | MSG_NOSIGNAL);
+                        }
+                    }else if constexpr (kIsBufferSequence)
+                        io_result = OsAbstraction::SendVectored(native_handle, buffer_view, MSG_DONTWAIT);
+                    else
+                        io_result = OsAbstraction::NonBlockingSend(native_handle, buffer_view);
+                } else if constexpr (OpType == OperationType::kSendFile || OpType == OperationType::kSpliceSend) {
+                    /* write readiness is edge-triggered: keep the pipe full until the socket would block */
+                    BufferView remaining{buffer_view};
+                    std::size_t transferred{0u};
+                    do {
+                        if constexpr (OpType == OperationType::kSendFile)
+                            io_result = OsAbstraction::SendFile(native_handle, remaining);
+                        else
+                            io_result = OsAbstraction::Splice(remaining.fd_, native_handle, remaining.size(), 
+                                SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+                        if(!io_result.has_value()) break;
+                        if(io_result.value() == 0){
+                            end_of_file = true;
+                            break;
+                        }
+                        transferred += io_result.value();
+                        remaining.Advance(io_result.value());
+                    } while(remaining.size() > 0);
+                    /* account for every chunk moved, not just the last one. an error after some progress
+                        is reported by the next attempt, the end of the file is reported below */
+                    if(transferred > 0)
+                        io_result = transferred;
+                } else if constexpr (OpType == OperationType::kSpliceReceive) {
+                    io_result = OsAbstraction::Splice(native_handle, buffer_view.fd_, buffer_view.size(), 
+                        SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
                 } else if constexpr (OpType == OperationType::kReceive) {
-                    io_result = OsAbstraction::ReceiveWithFlags(native_handle, buffer_view, MSG_DONTWAIT);
+                    if constexpr (kIsBufferSequence)
+                        io_result = OsAbstraction::ReceiveVectored(native_handle, buffer_view, MSG_DONTWAIT);
+                    else
+                        io_result = OsAbstraction::ReceiveWithFlags(native_handle, buffer_view, MSG_DONTWAIT);
                 } else {
                     LogFatalAndAbort("Unsupported op type!");
                 }
@@ -293,16 +372,38 @@ namespace Socket{
 
                 const std::size_t bytes_handled{io_result.value()};
                 if (bytes_handled == buffer_view.size()) { /* received full data */
-                    ASRT_LOG_TRACE("AsyncOperation: {} full {} byte(s) of data on sockfd {}: {}", OperationTypeStr(),
-                        (op_context == kContinuation ? 
-                            this->total_bytes_ : buffer_view.size()), native_handle,
-                            spdlog::to_hex((uint8_t*)buffer_view.data(), (uint8_t*)buffer_view.data() + buffer_view.size()));
-                    completion_result_.emplace(bytes_handled); //report success
+                    if constexpr (kIsBufferSequence) {
+                        ASRT_LOG_TRACE("AsyncOperation: {} full {} byte(s) of data in {} buffers on sockfd {}", OperationTypeStr(),
+                            (op_context == kContinuation ? 
+                                this->total_bytes_ : buffer_view.size()), buffer_view.Count(), native_handle);
+                    } else if constexpr (kIsKernelTransfer) {
+                        ASRT_LOG_TRACE("AsyncOperation: {} full {} byte(s) of fd {} on sockfd {}", OperationTypeStr(),
+                            (op_context == kContinuation ? 
+                                this->total_bytes_ : buffer_view.size()), buffer_view.fd_, native_handle);
+                    } else {
+                        ASRT_LOG_TRACE("AsyncOperation: {} full {} byte(s) of data on sockfd {}: {}", OperationTypeStr(),
+                            (op_context == kContinuation ? 
+                                this->total_bytes_ : buffer_view.size()), native_handle,
+                                spdlog::to_hex((uint8_t*)buffer_view.data(), (uint8_t*)buffer_view.data() + buffer_view.size()));
+                    }
+                    /* a continued operation reports everything handled since initiation */
+                    completion_result_.emplace(op_context == kContinuation ? this->total_bytes_ : bytes_handled); //report success
                     return {OperationStatus::kComplete, bytes_handled};
                 }
 
-                if constexpr (OpType == OperationType::kReceive){
-                    if(bytes_handled == 0) [[unlikely]] { /* end of file reached */
+                if constexpr (OpType == OperationType::kSendFile || OpType == OperationType::kSpliceSend) {
+                    if(end_of_file && bytes_handled > 0) [[unlikely]] { /* source shorter than the region, report what was sent */
+                        const std::size_t bytes_sent{op_context == kContinuation ? 
+                            this->total_bytes_ - buffer_view.size() + bytes_handled : bytes_handled};
+                        ASRT_LOG_TRACE("AsyncOperation: {} reached end of file after {} byte(s) on sockfd {}", 
+                            OperationTypeStr(), bytes_sent, native_handle);
+                        completion_result_.emplace(bytes_sent);
+                        return {OperationStatus::kComplete, bytes_handled};
+                    }
+                }
+
+                if constexpr (OpType == OperationType::kReceive || kIsKernelTransfer){
+                    if(bytes_handled == 0) [[unlikely]] { /* end of file reached (of the socket, the sent file or the pipe respectively) */
                         ASRT_LOG_TRACE("AsyncOperation: {}, reached end of file on sockfd {}", 
                             OperationTypeStr(), native_handle);
                         completion_result_ = MakeUnexpected(SockErrorCode::end_of_file); /* report eof */
@@ -8,6 +8,7 @@
 #include <errno.h>
 #include <cstring>
 #include <memory>
+#include <utility>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -217,6 +218,16 @@ public:
 
     bool IsNonBlocking() const noexcept {return this->isNonBlocking_;}
 
+    /**
+     * @brief Keep the reactor registration of the socket when it is closed, for the next handle assigned to it
+     * @details Meant for sockets that are recycled with accepted handles: closing the handle is all it takes to 
+     *  drop it from epoll, and the next accepted handle joins the same reactor slot and handler. The reserved
+     *  slot counts against the reactor handler capacity until the socket is destroyed.
+     * 
+     * @param retain 
+     */
+    void RetainReactorSlot(bool retain = true) noexcept {this->retain_reactor_slot_ = retain;}
+
     /* no need to check for undefined as setting state to undef will trigger an abort */
     /**
      * @brief Check socket is open (descriptor is valid)
@@ -399,6 +410,16 @@ protected:
             this->reactor_handle_, EventType::kRead);
     }
 
+    /**
+     * @brief Used by derived socket to notify base of a pending socket error queue read, eg: MSG_ZEROCOPY completions
+     * 
+     */
+    void AsyncErrorQueueOperationStarted() noexcept
+    {
+        this->GetReactorUnsafe().OperationStarted(
+            this->reactor_handle_, EventType::kError);
+    }
+
     /**
      * @brief Used by derived socket to notify reactor of an unhandled reactor event
      * 
@@ -411,8 +432,17 @@ protected:
 
     bool IsReactorHandleValid() const noexcept {return this->reactor_handle_ != ReactorNS::Types::kInvalidHandlerTag;}
 
+    /**
+     * @brief Register the socket for exclusive wakeup (EPOLLEXCLUSIVE) once it is opened, so that a readiness event 
+     *  wakes only one of several executors monitoring the same descriptor. Such a socket can not monitor write events.
+     * 
+     */
+    void UseExclusiveWakeup() noexcept { this->exclusive_wakeup_ = true; }
+
     Result<void> RegisterToReactor() noexcept;
 
+    Result<void> ReassignReactorSlot() noexcept;
+
     void AcquireLock() noexcept {this->GetMutexUnsafe().lock();}
     void ReleaseLock() noexcept {this->GetMutexUnsafe().unlock();}
 
@@ -455,12 +485,21 @@ private:
     Optional<Protocol> protocol_{};
     NativeHandleType socket_handle_{asrt::kInvalidNativeHandle};
     bool isNonBlocking_{false};
+    bool exclusive_wakeup_{false};
+    bool retain_reactor_slot_{false};
+    bool reactor_slot_reserved_{false}; /* closed with its reactor slot retained */
     std::uint8_t basic_socket_state_{0u}; /* start with closed state */
 
     void SetBasicSockState(BasicSocketState new_state) noexcept;
 
     Result<void> DoOpenSocket(const Protocol& proto) noexcept;
 
+    EventType ReactorRegistrationEvents() const noexcept
+    {
+        /* edge-triggered mode + eager registration for read events */
+        return this->exclusive_wakeup_ ? EventType::kReadEdgeExclusive : EventType::kReadEdge;
+    }
+
     auto MakeReactorEventHandler() noexcept {
         return 
             [this](std::unique_lock<MutexType>& lock, Events ev, ReactorHandle handle) {
@@ -478,12 +517,18 @@ MoveSocketFrom(BasicSocket&& other) noexcept
     if(!this->IsClosed()){
         LogFatalAndAbort("Failed to close original socket when moving from other socket");
     }
+    if(this->reactor_slot_reserved_){
+        static_cast<void>(this->GetReactorUnsafe().Deregister(this->reactor_handle_, false));
+    }
 
     this->socket_handle_ = other.socket_handle_;
     this->reactor_ = other.reactor_; //optiona<&> rebind semantics
     this->reactor_handle_ = other.reactor_handle_;
     this->basic_socket_state_ = other.basic_socket_state_;
     this->isNonBlocking_ = other.isNonBlocking_;
+    this->exclusive_wakeup_ = other.exclusive_wakeup_;
+    this->retain_reactor_slot_ = other.retain_reactor_slot_;
+    this->reactor_slot_reserved_ = std::exchange(other.reactor_slot_reserved_, false);
 
     this->reactor_.value().UpdateRegisteredHandler(
         this->reactor_handle_, this->MakeReactorEventHandler());
@@ -508,15 +553,26 @@ Close() noexcept -> Result<void>
     return this->CheckSocketClosed() /* return success if socket already closed */
         .or_else([this](SockErrorCode) -> Result<void> { /* socket is open */
             Derived().OnCloseEvent(); /* notify derived socket of close event (so that it may perform neccesary clean-up if any) */
-            if(this->HasReactor()){
+            if(this->HasReactor() && this->retain_reactor_slot_){
+                /* close the handle but keep the registration for the next handle assigned */
+                return this->GetReactorUnsafe().Detach(this->reactor_handle_)
+                    .map([this](){
+                        this->reactor_slot_reserved_ = true;
+                        this->SetBasicSockState(BasicSocketState::kClosed);
+                        this->socket_handle_ = asrt::kInvalidNativeHandle;
+                    })
+                    .map_error([](SockErrorCode ec){
+                        ASRT_LOG_ERROR("Failed to detach socket from reactor during close, {}", ec);
+                        return ec;
+                    });
+            }else if(this->HasReactor()){
                 /* de-register handle and close socket asynchronously through reactor if safe/possible */
                 return this->GetReactorUnsafe().Deregister(this->reactor_handle_, true)
                     .map([this](){
-                        //todo socket may not be actually closed at this point
-                        if(not this->GetReactorUnsafe().IsInUse(this->reactor_handle_)){
-                            this->SetBasicSockState(BasicSocketState::kClosed);
-                            this->socket_handle_ = asrt::kInvalidNativeHandle;
-                        } 
+                        /* if its handler is in progress the reactor closes the handle once the handler returns,
+                            the socket is closed for its user either way */
+                        this->SetBasicSockState(BasicSocketState::kClosed);
+                        this->socket_handle_ = asrt::kInvalidNativeHandle;
                     })
                     .map_error([](SockErrorCode ec){
                         ASRT_LOG_ERROR("Failed to deregister socket during close, {}", ec);
@@ -553,6 +609,9 @@ Destroy() noexcept
             descriptor in another thread has no effect on select()" */
             static_cast<void>(OsAbstraction::Close(this->GetNativeHandle()));
         }
+    }else if(this->reactor_slot_reserved_){
+        /* release the reactor slot retained on close */
+        static_cast<void>(this->GetReactorUnsafe().Deregister(this->reactor_handle_, false));
     }
 }
 
@@ -588,7 +647,9 @@ AssignNativeHandle(const Protocol& protocol, NativeHandleType handle) noexcept -
     Result<void> result{};
     this->socket_handle_ = handle;
 
-    if(this->HasReactor() && !this->IsReactorHandleValid()) [[likely]] {
+    if(this->reactor_slot_reserved_) [[unlikely]] {
+        result = this->ReassignReactorSlot().map([this]{this->isNonBlocking_ = true;});
+    }else if(this->HasReactor() && !this->IsReactorHandleValid()) [[likely]] {
         result = this->RegisterToReactor().map([this]{this->isNonBlocking_ = true;});
     }
 
@@ -788,7 +849,8 @@ RegisterToReactor() noexcept -> Result<void>
 {
     return 
         this->reactor_.value().Register(
-            this->socket_handle_, EventType::kReadEdge, /* edge-triggered mode + eager registration for read events */
+            this->socket_handle_, 
+            this->ReactorRegistrationEvents(),
             this->MakeReactorEventHandler()
         )
         .map([this](const auto& registry) {
@@ -800,6 +862,27 @@ RegisterToReactor() noexcept -> Result<void>
 }
 
 
+template<typename Protocol, class DerivedSocket, class Executor>
+inline auto BasicSocket<Protocol, DerivedSocket, Executor>::
+ReassignReactorSlot() noexcept -> Result<void>
+{
+    this->reactor_slot_reserved_ = false;
+    return 
+        this->GetReactorUnsafe().Reassign(
+            this->reactor_handle_, this->socket_handle_, this->ReactorRegistrationEvents())
+        .map([this](){
+            ASRT_LOG_TRACE("[BasicSocket]: Sockfd {} joined retained reactor handle {}", 
+                this->socket_handle_, this->reactor_handle_);
+        })
+        .or_else([this](SockErrorCode ec) -> Result<void> {
+            /* eg: the handler is still running for the previous handle */
+            ASRT_LOG_DEBUG("[BasicSocket]: Unable to reuse reactor handle {}, {}. Registering anew", 
+                this->reactor_handle_, ec);
+            static_cast<void>(this->GetReactorUnsafe().Deregister(this->reactor_handle_, false));
+            return this->RegisterToReactor();
+        });
+}
+
 template<typename Protocol, class DerivedSocket, class Executor>
 inline auto BasicSocket<Protocol, DerivedSocket, Executor>::
 CheckAsyncPreconditionsMet() noexcept -> Result<void>
@@ -14,6 +14,10 @@
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <concepts>
 
 #include "asrt/socket/basic_socket.hpp"
 #include "asrt/error_code.hpp"
@@ -39,6 +43,8 @@ using ReceiveCompletionHandler = std::function<void(ReceiveResult&& receive_resu
 using ConnectCompletionHandler = std::function<void(Result<void>)>;
 using ReceiveBuffer = Buffer::MutableBufferView;
 using SendBuffer = Buffer::ConstBufferView;
+using ReceiveBufferSequence = Buffer::MutableBufferSequence;
+using SendBufferSequence = Buffer::ConstBufferSequence;
 using SockAddressView = Buffer::ConstBufferView;
 
 struct PeerCredentials 
@@ -61,8 +67,121 @@ private:
     ::ucred data_;
 };
 
+/**
+ * @brief Describes how to delimit frames of a byte stream, see ReceiveFramed()
+ * @details HeaderLength() bytes at the start of each frame are passed to FrameLength(), 
+ *  which returns the length of the whole frame including the header or an error if 
+ *  the header is invalid.
+ */
+template <typename Codec>
+concept FrameCodec = requires(Codec const& codec, Buffer::ConstBufferView header) {
+    { codec.HeaderLength() } -> std::convertible_to<std::size_t>;
+    { codec.FrameLength(header) } -> std::same_as<Result<std::size_t>>;
+};
+
+/**
+ * @brief The complete frames found at the start of a buffer, see LengthPrefixCodec::ScanFrames()
+ */
+struct FrameRun
+{
+    std::size_t frames_; /* number of complete frames */
+    std::size_t bytes_; /* total length of those frames */
+};
+
+/**
+ * @brief Frames whose header carries the payload length as a big endian integer
+ * 
+ * @tparam LengthType unsigned integer type of the length field
+ * @tparam kLengthOffset offset of the length field in the header, eg: to skip a message type
+ */
+template <std::unsigned_integral LengthType = std::uint32_t, std::size_t kLengthOffset = 0u>
+struct LengthPrefixCodec
+{
+    /* frames announcing larger payloads are rejected with message_size */
+    std::size_t max_payload_length_{std::numeric_limits<LengthType>::max()};
+    /* whether the length field counts the header as well as the payload */
+    bool length_includes_header_{false};
+
+    static constexpr std::size_t HeaderLength() noexcept { return kLengthOffset + sizeof(LengthType); }
+
+    Result<std::size_t> FrameLength(Buffer::ConstBufferView header) const noexcept
+    {
+        assert(header.size() >= HeaderLength());
+        std::size_t length{asrt::details::LoadBigEndian<LengthType>(
+            static_cast<std::uint8_t const*>(header.data()) + kLengthOffset)};
+
+        if(this->length_includes_header_){
+            if(length < HeaderLength()) [[unlikely]] 
+                return MakeUnexpected(SockErrorCode::invalid_argument);
+            length -= HeaderLength();
+        }
+        if(length > this->max_payload_length_) [[unlikely]] 
+            return MakeUnexpected(SockErrorCode::message_size);
+
+        return HeaderLength() + length;
+    }
+
+    /**
+     * @brief Validate the run of complete frames at the start of buffer in one pass
+     * @details Lets a consumer dispatch every frame that arrived with a single receive 
+     *  without re-entering ReceiveFramed() per frame. A trailing partial frame is not counted.
+     * 
+     * @return Result<FrameRun> the complete frames found, or the error of the first invalid header
+     */
+    Result<FrameRun> ScanFrames(Buffer::ConstBufferView buffer) const noexcept
+    {
+        auto const* data{static_cast<std::uint8_t const*>(buffer.data())};
+        FrameRun run{};
+
+        while(buffer.size() - run.bytes_ >= HeaderLength()){
+            auto const frame_length{this->FrameLength({data + run.bytes_, HeaderLength()})};
+            if(!frame_length.has_value()) [[unlikely]] 
+                return MakeUnexpected(frame_length.error());
+            if(buffer.size() - run.bytes_ < frame_length.value()) 
+                break;
+            run.bytes_ += frame_length.value();
+            ++run.frames_;
+        }
+        return run;
+    }
+};
+
+/**
+ * @brief Counters of zero-copy sends, see BasicStreamSocket::SendZeroCopyAsync()
+ */
+struct ZeroCopyStatistics
+{
+    std::uint64_t completions_; /* send calls whose buffers the kernel released */
+    std::uint64_t copied_; /* those of them the kernel copied after all, eg: on loopback */
+};
+
 namespace details{
 
+    /* progress of locating a frame in the readable bytes of a dynamic buffer */
+    struct FrameStatus
+    {
+        std::size_t frame_length_; /* non-zero once a complete frame is available */
+        std::size_t bytes_missing_; /* lower bound of the bytes still to be received */
+    };
+
+    enum class ZeroCopyPhase : std::uint8_t
+    {
+        kIdle,
+        kSending, /* the send operation is transmitting the buffer */
+        kReleasing /* all bytes sent, waiting for the kernel to release the buffer */
+    };
+
+    struct ZeroCopyState
+    {
+        bool enabled_{false}; /* SO_ZEROCOPY set */
+        ZeroCopyPhase phase_{ZeroCopyPhase::kIdle};
+        std::uint32_t next_id_{}; /* id the kernel assigns to the next zero-copy send call */
+        std::uint32_t released_{}; /* number of zero-copy send calls whose buffers were released */
+        ZeroCopyStatistics statistics_{};
+        SendCompletionHandler handler_{}; /* parked until the buffer is released */
+        SendResult result_{};
+    };
+
     enum class BasicStreamSocketState : std::uint8_t
     {
         kDisconnected = 0u,
@@ -129,6 +248,7 @@ class BasicStreamSocket final :
 public:
     using Base = BasicSocket<Protocol, BasicStreamSocket, Executor>;
     using typename Base::BasicSocketState;
+    using typename Base::ExecutorType;
     using typename Base::Reactor;
     using typename Base::NativeHandleType;
     using typename Base::SockErrorCode;
@@ -203,8 +323,10 @@ public:
 
     /**
      * @brief Tries to send the data contained in the buffer, and schedules asynchronous send if not all data could be sent. 
+     * @details send_view may also be a SendBufferSequence, in which case all buffers are gathered 
+     *  into vectored sends and a partial send is resumed from the first unsent byte.
      * 
-     * @tparam SendBufferView 
+     * @tparam SendBufferView SendBuffer or SendBufferSequence
      * @tparam SendCompletionHandler 
      * @param send_view 
      * @param callback 
@@ -212,6 +334,87 @@ public:
     template <typename SendBufferView, typename SendCompletionHandler>
     void SendAsync(SendBufferView send_view, SendCompletionHandler&& callback) noexcept;
 
+    /**
+     * @brief Allow SendZeroCopyAsync() on this socket by setting SO_ZEROCOPY
+     * @note Supported by TCP sockets only
+     * 
+     * @return Result<void> 
+     */
+    auto EnableZeroCopy() noexcept -> Result<void>;
+
+    /**
+     * @brief Like SendAsync(), but the kernel transmits straight from send_view instead of copying it (MSG_ZEROCOPY).
+     * @details The completion handler is invoked only after the kernel has reported through the socket 
+     *  error queue that it released every byte of send_view, which therefore must stay valid and unmodified 
+     *  until then. Each send call pins pages and costs a notification, so this pays off for payloads 
+     *  of hundreds of KB and more. Completes with operation_not_supported unless EnableZeroCopy() succeeded 
+     *  and with async_operation_in_progress while a send is ongoing or a zero-copy send awaits release.
+     * 
+     * @tparam SendBufferView SendBuffer or SendBufferSequence
+     * @tparam SendCompletionHandler 
+     * @param send_view 
+     * @param callback 
+     */
+    template <typename SendBufferView, typename SendCompletionHandler>
+    void SendZeroCopyAsync(SendBufferView send_view, SendCompletionHandler&& callback) noexcept;
+
+    /**
+     * @brief Counters of the zero-copy sends performed on this socket
+     */
+    ZeroCopyStatistics GetZeroCopyStatistics() const noexcept { return this->zero_copy_.statistics_; }
+
+    /**
+     * @brief Send length bytes of the file file_fd starting at offset, without the data ever entering user space.
+     * @details The transfer is performed with sendfile(2) and continued on write readiness until the whole 
+     *  range has been sent. The file offset of file_fd is left untouched, so several transfers may share 
+     *  one file descriptor. Completes with the number of bytes sent, with end_of_file if the file ends 
+     *  before the range does and with async_operation_in_progress while another send is ongoing.
+     * 
+     * @tparam SendCompletionHandler 
+     * @param file_fd must stay open until the handler is invoked. Must support mmap-like operations (eg: a regular file).
+     * @param offset 
+     * @param length 
+     * @param callback 
+     */
+    template <typename SendCompletionHandler>
+    void SendFileAsync(int file_fd, ::off_t offset, std::size_t length, SendCompletionHandler&& callback) noexcept;
+
+    /**
+     * @brief Move up to max_length received bytes from this socket into the pipe pipe_fd with splice(2).
+     * @details Completes like ReceiveSomeAsync() with the number of bytes moved as soon as any are available, 
+     *  with end_of_file once the peer shut down its sending side. Data never enters user space. 
+     *  See Socket::Splicer for relaying between two sockets.
+     * 
+     * @tparam ReceiveCompletionHandler 
+     * @param pipe_fd write end of a pipe
+     * @param max_length 
+     * @param callback 
+     */
+    template <typename ReceiveCompletionHandler>
+    void SpliceReceiveAsync(int pipe_fd, std::size_t max_length, ReceiveCompletionHandler&& callback) noexcept;
+
+    /**
+     * @brief Send length bytes held by the pipe pipe_fd on this socket with splice(2).
+     * @details The pipe must already contain at least length bytes. Completes with length once all of them 
+     *  have been sent and with async_operation_in_progress while another send is ongoing. 
+     *  If the write end of the pipe is closed, completes with the bytes it still held or with end_of_file if none.
+     * 
+     * @tparam SendCompletionHandler 
+     * @param pipe_fd read end of a pipe
+     * @param length 
+     * @param callback 
+     */
+    template <typename SendCompletionHandler>
+    void SpliceSendAsync(int pipe_fd, std::size_t length, SendCompletionHandler&& callback) noexcept;
+
+    /**
+     * @brief Disable sends and/or receives on the socket, eg: to propagate a half-close.
+     * 
+     * @param type 
+     * @return Result<void> 
+     */
+    auto Shutdown(Socket::Types::ShutdownType type) noexcept -> Result<void>;
+
 
     /**
      * @brief Tries to send as much data contained in the buffer as possible but may send only partial data.
@@ -226,7 +429,7 @@ public:
     /**
      * @brief Send all data in buffer synchronously
      * 
-     * @tparam SendBufferView 
+     * @tparam SendBufferView SendBuffer or SendBufferSequence
      * @param send_view 
      * @return Result<void> 
      */
@@ -247,6 +450,7 @@ public:
     /**
      * @brief Receive from peer into recv_view. Handler will be invoked when operation is complete.
      * 
+     * @tparam ReceiveBufferView ReceiveBuffer or ReceiveBufferSequence. Sequences are filled in order.
      * @tparam ReceiveCompletionCallback 
      * @param recv_view view of buffer into which message will be received
      * @param handler the callback that gets called when reception is complete
@@ -274,6 +478,36 @@ public:
     template<typename ReceiveCompletionCallback>
     void ReceiveSomeAsync(ReceiveBuffer recv_view, ReceiveCompletionCallback&& handler) noexcept;
 
+    /**
+     * @brief Receive into buffer until its readable bytes contain delimiter
+     * @details Bytes already in the buffer are searched first. Each receive fills as much of the 
+     *  buffer as is available, so bytes following the delimiter may be received as well; they stay 
+     *  in the buffer for the next call. The handler is passed the length of the frame at the 
+     *  front of buffer.Data(), including the delimiter. The caller Consume()s it once handled.
+     * 
+     * @tparam ReceiveCompletionCallback void(ReceiveResult)
+     * @param buffer must outlive the operation
+     * @param delimiter 
+     * @param handler 
+     */
+    template <typename ReceiveCompletionCallback>
+    void ReceiveUntil(Buffer::DynamicBuffer& buffer, std::string_view delimiter, ReceiveCompletionCallback&& handler) noexcept;
+
+    /**
+     * @brief Receive into buffer until it holds a complete frame as described by codec
+     * @details Once the header is available the receive asks for the remainder of the frame at 
+     *  once. The handler is passed the length of the frame at the front of buffer.Data(). 
+     *  The caller Consume()s it once handled.
+     * 
+     * @tparam Codec eg: LengthPrefixCodec
+     * @tparam ReceiveCompletionCallback void(ReceiveResult)
+     * @param buffer must outlive the operation
+     * @param codec 
+     * @param handler 
+     */
+    template <FrameCodec Codec, typename ReceiveCompletionCallback>
+    void ReceiveFramed(Buffer::DynamicBuffer& buffer, Codec codec, ReceiveCompletionCallback&& handler) noexcept;
+
     /**
      * @brief 
      * 
@@ -328,17 +562,38 @@ private:
     using SendOperation = 
         Socket::AsyncOperation< 
             OperationType::kSend, 
-            SendBuffer, 
+            SendBufferSequence, 
             SendResult, 
             SendCompletionHandler>;
 
     using ReceiveOperation = 
         Socket::AsyncOperation< 
             OperationType::kReceive, 
-            ReceiveBuffer, 
+            ReceiveBufferSequence, 
+            ReceiveResult, 
+            ReceiveCompletionHandler>;
+
+    using SendFileOperation = 
+        Socket::AsyncOperation< 
+            OperationType::kSendFile, 
+            Socket::Types::FileRegion, 
+            SendResult, 
+            SendCompletionHandler>;
+
+    using SpliceReceiveOperation = 
+        Socket::AsyncOperation< 
+            OperationType::kSpliceReceive, 
+            Socket::Types::PipeRegion, 
             ReceiveResult, 
             ReceiveCompletionHandler>;
 
+    using SpliceSendOperation = 
+        Socket::AsyncOperation< 
+            OperationType::kSpliceSend, 
+            Socket::Types::PipeRegion, 
+            SendResult, 
+            SendCompletionHandler>;
+
     using ConnectOperation = 
         Socket::AsyncOperation< 
             OperationType::kConnect, 
@@ -352,8 +607,19 @@ private:
     template <typename ReceiveBufferView, typename ReceiveCompletionCallback>
     void DoReceiveAsync(ReceiveBufferView recv_view, ReceiveCompletionCallback&& callback, int op_mode = 0) noexcept;
 
+    template <typename FrameLocator, typename ReceiveCompletionCallback>
+    void DoReceiveFrame(Buffer::DynamicBuffer& buffer, FrameLocator&& locate, 
+        ReceiveCompletionCallback&& callback, OperationContext op_context) noexcept;
+
     template <typename SendCompletionCallback>
-    void DoSendAsync(SendBuffer send_view, SendCompletionCallback&& callback, int op_mode = 0) noexcept;
+    void DoSendAsync(SendBufferSequence const& send_view, SendCompletionCallback&& callback, int op_mode = 0) noexcept;
+
+    /**
+     * @brief Initiate a sendfile/splice operation, the data of which never enters user space
+     */
+    template <typename KernelOperation, typename CompletionCallback>
+    void DoKernelTransferAsync(KernelOperation& operation, typename KernelOperation::BufferViewType const& view, 
+        CompletionCallback&& callback) noexcept;
 
     void NotifySendResult(std::unique_lock<MutexType>& lock, Result<void>&& result) noexcept;
     void NotifyReceiveResult(std::unique_lock<MutexType>& lock, ReceiveResult&& result) noexcept;
@@ -375,22 +641,57 @@ private:
 
 
     void HandleSend(std::unique_lock<MutexType>& lock) noexcept;
+    template <typename KernelOperation>
+    void HandleKernelTransfer(KernelOperation& operation, std::unique_lock<MutexType>& lock) noexcept;
     void HandleReceive(std::unique_lock<MutexType>& lock) noexcept;
 
+    /**
+     * @brief Park the completion of a zero-copy send until the kernel released its buffer
+     * @param lock held in reactor context, nullptr in initiation context
+     */
+    void OnZeroCopySendComplete(SendCompletionHandler&& callback, SendResult&& result, std::unique_lock<MutexType>* lock) noexcept;
+    void HandleZeroCopyRelease(std::unique_lock<MutexType>& lock) noexcept;
+    void DrainZeroCopyNotifications() noexcept;
+
     Result<void> CheckSendPossible() const noexcept;
 
     Result<void> CheckRecvPossible() const noexcept;
 
-    bool IsAsyncInProgress() const noexcept {return (this->send_operation_.IsOngoing() || this->recv_operation_.IsOngoing());}
+    bool IsAsyncInProgress() const noexcept 
+    {
+        return (this->IsAsyncSendInProgress() || this->IsAsyncReceiveInProgress());
+    }
+
+    /* any send sharing the outgoing byte stream */
+    bool IsAsyncSendInProgress() const noexcept 
+    {
+        return (this->send_operation_.IsOngoing() || this->send_file_operation_.IsOngoing() || 
+            this->splice_send_operation_.IsOngoing() ||
+            this->zero_copy_.phase_ != Socket::details::ZeroCopyPhase::kIdle);
+    }
+
+    /* any receive sharing the incoming byte stream */
+    bool IsAsyncReceiveInProgress() const noexcept 
+    {
+        return (this->recv_operation_.IsOngoing() || this->splice_recv_operation_.IsOngoing());
+    }
 
     ReceiveResult DoReceiveSync(ReceiveBuffer recv_view, int flags = 0) noexcept;
 
     SendOperation send_operation_{};
 
+    SendFileOperation send_file_operation_{};
+
+    SpliceSendOperation splice_send_operation_{};
+
     ReceiveOperation recv_operation_{};
 
+    SpliceReceiveOperation splice_recv_operation_{};
+
     ConnectOperation connect_operation_{};
 
+    Socket::details::ZeroCopyState zero_copy_{};
+
     BasicStreamSocketState stream_sock_state_{BasicStreamSocketState::kDisconnected};
 
 }; //end class BasicStreamSocket
@@ -406,6 +707,7 @@ BasicStreamSocket(BasicStreamSocket&& other) noexcept
     Base::MoveSocketFrom(std::move(other)); /* close socket and transfer reactor here */
 
     this->stream_sock_state_ = other.stream_sock_state_;
+    this->zero_copy_.enabled_ = other.zero_copy_.enabled_;
 
     //todo transfer send/recv/connect operations
     /* No need to move additional members. They are only valid during an ongoing asynchronous operation. */ 
@@ -482,6 +784,114 @@ SendAsync(SendBufferView send_view, SendCompletionCallback&& callback) noexcept
     this->DoSendAsync(send_view, std::move(callback), kSpeculative | kExhaustive);
 }
 
+template <typename Protocol, class Executor>
+template <typename SendBufferView, typename SendCompletionCallback>
+inline void BasicStreamSocket<Protocol, Executor>::
+SendZeroCopyAsync(SendBufferView send_view, SendCompletionCallback&& callback) noexcept
+{
+    using namespace Socket::Types;
+    using Socket::details::ZeroCopyPhase;
+    ASRT_LOG_TRACE("Socket fd {} Start async zero-copy send", this->GetNativeHandle());
+    assert(Base::IsAsyncPreconditionsMet());
+    std::scoped_lock const lock{Base::GetMutexUnsafe()};
+
+    auto const reject{[this, &callback](SockErrorCode ec){
+        Base::PostImmediateExecutorJob(
+            [callback = std::move(callback), ec]() mutable {
+                callback(SendResult{MakeUnexpected(ec)});
+            });
+    }};
+
+    if(!this->zero_copy_.enabled_) [[unlikely]] {
+        reject(SockErrorCode::operation_not_supported);
+    }else if(this->IsAsyncSendInProgress()) [[unlikely]] {
+        reject(SockErrorCode::async_operation_in_progress);
+    }else{
+        this->zero_copy_.phase_ = ZeroCopyPhase::kSending;
+        this->DoSendAsync(send_view, std::move(callback), kSpeculative | kExhaustive | kZeroCopy);
+    }
+}
+
+template <typename Protocol, class Executor>
+template <typename SendCompletionCallback>
+inline void BasicStreamSocket<Protocol, Executor>::
+SendFileAsync(int file_fd, ::off_t offset, std::size_t length, SendCompletionCallback&& callback) noexcept
+{
+    ASRT_LOG_TRACE("Socket fd {} Start async send of {} bytes from file fd {}", this->GetNativeHandle(), length, file_fd);
+    assert(Base::IsAsyncPreconditionsMet());
+    std::scoped_lock const lock{Base::GetMutexUnsafe()};
+
+    this->DoKernelTransferAsync(this->send_file_operation_, 
+        Socket::Types::FileRegion{file_fd, offset, length}, std::forward<SendCompletionCallback>(callback));
+}
+
+template <typename Protocol, class Executor>
+template <typename ReceiveCompletionCallback>
+inline void BasicStreamSocket<Protocol, Executor>::
+SpliceReceiveAsync(int pipe_fd, std::size_t max_length, ReceiveCompletionCallback&& callback) noexcept
+{
+    ASRT_LOG_TRACE("Socket fd {} Start async splice of up to {} bytes into pipe fd {}", this->GetNativeHandle(), max_length, pipe_fd);
+    assert(Base::IsAsyncPreconditionsMet());
+    std::scoped_lock const lock{Base::GetMutexUnsafe()};
+
+    this->DoKernelTransferAsync(this->splice_recv_operation_, 
+        Socket::Types::PipeRegion{pipe_fd, max_length}, std::forward<ReceiveCompletionCallback>(callback));
+}
+
+template <typename Protocol, class Executor>
+template <typename SendCompletionCallback>
+inline void BasicStreamSocket<Protocol, Executor>::
+SpliceSendAsync(int pipe_fd, std::size_t length, SendCompletionCallback&& callback) noexcept
+{
+    ASRT_LOG_TRACE("Socket fd {} Start async splice of {} bytes from pipe fd {}", this->GetNativeHandle(), length, pipe_fd);
+    assert(Base::IsAsyncPreconditionsMet());
+    std::scoped_lock const lock{Base::GetMutexUnsafe()};
+
+    this->DoKernelTransferAsync(this->splice_send_operation_, 
+        Socket::Types::PipeRegion{pipe_fd, length}, std::forward<SendCompletionCallback>(callback));
+}
+
+template <typename Protocol, class Executor>
+template <typename KernelOperation, typename CompletionCallback>
+inline void BasicStreamSocket<Protocol, Executor>::
+DoKernelTransferAsync(KernelOperation& operation, typename KernelOperation::BufferViewType const& view, 
+    CompletionCallback&& callback) noexcept
+{
+    using namespace Socket::Types;
+    constexpr bool kIsReceive{std::is_same_v<KernelOperation, SpliceReceiveOperation>};
+
+    auto immediate_completion{
+        [this](CompletionCallback&& cb, Result<std::size_t>&& res){
+            Base::PostImmediateExecutorJob(
+                [callback = std::move(cb), result = std::move(res)]() mutable {
+                    callback(std::move(result));
+                });
+        }};
+
+    bool const busy{kIsReceive ? this->IsAsyncReceiveInProgress() : this->IsAsyncSendInProgress()};
+    if(busy) [[unlikely]] {
+        immediate_completion(std::forward<CompletionCallback>(callback), 
+            Result<std::size_t>{MakeUnexpected(SockErrorCode::async_operation_in_progress)});
+        return;
+    }
+
+    /* receives always try right away: a previous splice may have left data behind without a new edge to report it */
+    Socket::Types::OperationStatus const op_status{
+        operation.Perform(
+            Base::GetNativeHandle(),
+            kIsReceive ? kSpeculative : (kSpeculative | kExhaustive), 
+            view,
+            std::forward<CompletionCallback>(callback),
+            std::move(immediate_completion))};
+
+    if(op_status != OperationStatus::kComplete) {
+        if constexpr (kIsReceive) 
+            Base::AsyncReadOperationStarted();
+        else 
+            Base::AsyncWriteOperationStarted();
+    }
+}
+
 template <typename Protocol, class Executor>
 template <typename SendBufferView>
 inline auto BasicStreamSocket<Protocol, Executor>::
@@ -489,8 +899,11 @@ SendSome(SendBufferView send_view) noexcept -> Result<size_t>
 {
     std::scoped_lock const lock{Base::GetMutex()};
     return this->CheckSendPossible()
-        .and_then([this, send_view](){
-            return OsAbstraction::Send(this->GetNativeHandle(), send_view);
+        .and_then([this, &send_view](){
+            if constexpr (BufferViewTraits::is_sequence<SendBufferView>::value)
+                return OsAbstraction::SendVectored(this->GetNativeHandle(), send_view);
+            else
+                return OsAbstraction::Send(this->GetNativeHandle(), send_view);
         })
         .map_error([this](SockErrorCode error){
             if(((this->stream_sock_state_ == BasicStreamSocketState::kConnected) || (this->stream_sock_state_ == BasicStreamSocketState::kDormant)) && 
@@ -510,8 +923,11 @@ SendSync(SendBufferView send_view) noexcept -> Result<void>
     using enum BasicStreamSocketState;
     std::scoped_lock const lock{Base::GetMutex()};
     return this->CheckSendPossible()
-        .and_then([this, send_view](){
-            return OsAbstraction::SendAll(this->GetNativeHandle(), send_view);
+        .and_then([this, &send_view](){
+            if constexpr (BufferViewTraits::is_sequence<SendBufferView>::value)
+                return OsAbstraction::SendAllVectored(this->GetNativeHandle(), send_view);
+            else
+                return OsAbstraction::SendAll(this->GetNativeHandle(), send_view);
         })
         .map_error([this](SockErrorCode error){
             if(((this->stream_sock_state_ == kConnected) || (this->stream_sock_state_ == kDormant)) && //todo
@@ -543,11 +959,15 @@ TrySend(SendBufferView send_view, SendCompletionCallback&& callback) noexcept ->
 template <typename Protocol, class Executor>
 template <typename SendCompletionCallback>
 inline void BasicStreamSocket<Protocol, Executor>::
-DoSendAsync(SendBuffer send_view, SendCompletionCallback&& callback, int op_mode) noexcept
+DoSendAsync(SendBufferSequence const& send_view, SendCompletionCallback&& callback, int op_mode) noexcept
 {
     using namespace Socket::Types;
     auto immediate_completion{
-        [this](SendCompletionCallback&& cb, SendResult&& res){
+        [this, op_mode](SendCompletionCallback&& cb, SendResult&& res){
+            if(op_mode & kZeroCopy) [[unlikely]] {
+                this->OnZeroCopySendComplete(std::move(cb), std::move(res), nullptr);
+                return;
+            }
             Base::PostImmediateExecutorJob(
                 [callback = std::move(cb), result = std::move(res)](){
                     callback(std::move(result));
@@ -644,6 +1064,106 @@ ReceiveSomeAsync(ReceiveBuffer recv_view, ReceiveCompletionCallback&& callback)
     this->DoReceiveAsync(recv_view, std::move(callback), op_mode);
 }
 
+template <typename Protocol, class Executor>
+template <typename ReceiveCompletionCallback>
+inline void BasicStreamSocket<Protocol, Executor>::
+ReceiveUntil(Buffer::DynamicBuffer& buffer, std::string_view delimiter, ReceiveCompletionCallback&& callback) noexcept
+{
+    using Socket::details::FrameStatus;
+    ASRT_LOG_TRACE("ReceiveUntil entry");
+
+    auto locate_delimiter{
+        [delimiter = std::string{delimiter}, searched = std::size_t{}]
+        (Buffer::ConstBufferView readable) mutable -> Result<FrameStatus> {
+            if(delimiter.empty()) [[unlikely]] 
+                return MakeUnexpected(SockErrorCode::invalid_argument);
+
+            std::size_t const offset{Buffer::FindDelimiter(readable.SubView(searched), delimiter)};
+            if(offset != Buffer::kDynamicExtent){
+                return FrameStatus{searched + offset + delimiter.size(), 0u};
+            }
+            /* a later match may only start in the last delimiter.size() - 1 bytes searched */
+            searched = std::max(searched, (readable.size() + 1u > delimiter.size()) ? 
+                readable.size() + 1u - delimiter.size() : std::size_t{0u});
+            return FrameStatus{0u, 1u};
+        }};
+
+    this->DoReceiveFrame(buffer, std::move(locate_delimiter), std::move(callback), OperationContext::kInitiation);
+}
+
+template <typename Protocol, class Executor>
+template <FrameCodec Codec, typename ReceiveCompletionCallback>
+inline void BasicStreamSocket<Protocol, Executor>::
+ReceiveFramed(Buffer::DynamicBuffer& buffer, Codec codec, ReceiveCompletionCallback&& callback) noexcept
+{
+    using Socket::details::FrameStatus;
+    ASRT_LOG_TRACE("ReceiveFramed entry");
+
+    auto locate_frame{
+        [codec = std::move(codec)](Buffer::ConstBufferView readable) -> Result<FrameStatus> {
+            std::size_t const header_length{codec.HeaderLength()};
+            if(readable.size() < header_length){
+                return FrameStatus{0u, header_length - readable.size()};
+            }
+            return codec.FrameLength(readable.first(header_length))
+                .map([&readable](std::size_t frame_length){
+                    return (readable.size() >= frame_length) ?
+                        FrameStatus{frame_length, 0u} :
+                        FrameStatus{0u, frame_length - readable.size()};
+                });
+        }};
+
+    this->DoReceiveFrame(buffer, std::move(locate_frame), std::move(callback), OperationContext::kInitiation);
+}
+
+template <typename Protocol, class Executor>
+template <typename FrameLocator, typename ReceiveCompletionCallback>
+inline void BasicStreamSocket<Protocol, Executor>::
+DoReceiveFrame(Buffer::DynamicBuffer& buffer, FrameLocator&& locate, 
+    ReceiveCompletionCallback&& callback, OperationContext op_context) noexcept
+{
+    auto complete{
+        [this, op_context](ReceiveCompletionCallback&& cb, ReceiveResult&& res){
+            if(op_context == OperationContext::kContinuation){
+                cb(std::move(res)); /* already in executor context */
+            }else{
+                Base::PostImmediateExecutorJob(
+                    [callback = std::move(cb), result = std::move(res)]() mutable {
+                        callback(std::move(result));
+                    });
+            }
+        }};
+
+    Result<Socket::details::FrameStatus> const status{locate(buffer.Data())};
+    if(not status.has_value()) [[unlikely]] {
+        complete(std::move(callback), MakeUnexpected(status.error()));
+        return;
+    }
+    if(status->frame_length_ > 0u){ /* frame complete, possibly with bytes received earlier */
+        complete(std::move(callback), ReceiveResult{status->frame_length_});
+        return;
+    }
+
+    Buffer::MutableBufferView const space{
+        buffer.Prepare(std::max(status->bytes_missing_, asrt::config::kMinReceiveChunkSize))};
+    if(space.Empty()) [[unlikely]] {
+        ASRT_LOG_DEBUG("Frame exceeds dynamic buffer max size {}", buffer.MaxSize());
+        complete(std::move(callback), MakeUnexpected(SockErrorCode::capacity_exceeded));
+        return;
+    }
+
+    this->ReceiveSomeAsync(space,
+        [this, &buffer, locator = std::move(locate), cb = std::move(callback)]
+        (ReceiveResult recv_result) mutable {
+            if(not recv_result.has_value()) [[unlikely]] {
+                cb(std::move(recv_result));
+                return;
+            }
+            buffer.Commit(recv_result.value());
+            this->DoReceiveFrame(buffer, std::move(locator), std::move(cb), OperationContext::kContinuation);
+        });
+}
+
 template <typename Protocol, class Executor>
 inline void BasicStreamSocket<Protocol, Executor>::
 OnCloseEvent() noexcept
@@ -736,6 +1256,8 @@ HandleDataTranster(ReactorEvents ev, std::unique_lock<MutexType>& lock) noexcept
             since we may receive events that we never registered for */
         if(this->recv_operation_.IsOngoing()) [[likely]]
             this->HandleReceive(lock);
+        else if(this->splice_recv_operation_.IsOngoing())
+            this->HandleKernelTransfer(this->splice_recv_operation_, lock);
         else [[unlikely]] {
             ASRT_LOG_TRACE("Got uninteresting read event");
             Base::OnReactorEventIgnored(EventType::kRead);
@@ -755,6 +1277,19 @@ HandleDataTranster(ReactorEvents ev, std::unique_lock<MutexType>& lock) noexcept
                 }
             }
         }
+
+    /* sendfile and splice sends */
+    if(ev.HasWriteEvent() && this->IsConnected()) [[likely]] {
+        if(this->send_file_operation_.IsOngoing()) [[unlikely]]
+            this->HandleKernelTransfer(this->send_file_operation_, lock);
+        else if(this->splice_send_operation_.IsOngoing()) [[unlikely]]
+            this->HandleKernelTransfer(this->splice_send_operation_, lock);
+    }
+
+    /* error queue readable: zero-copy completions arrived */
+    if(ev.HasErrorEvent()) [[unlikely]]
+        if(this->zero_copy_.phase_ == Socket::details::ZeroCopyPhase::kReleasing)
+            this->HandleZeroCopyRelease(lock);
 }
 
 template <typename Protocol, class Executor>
@@ -766,10 +1301,16 @@ HandleSend(std::unique_lock<MutexType>& lock) noexcept
 
     auto on_immediate_completion{
         [this, &lock](auto&& callback, SendResult&& res){
+            if(this->zero_copy_.phase_ == Socket::details::ZeroCopyPhase::kSending) [[unlikely]] {
+                this->OnZeroCopySendComplete(std::move(callback), std::move(res), &lock);
+                return;
+            }
             ASRT_LOG_TRACE("Notifying send completion");
+            /* take the handler out of the operation, it may start the next send */
+            std::remove_cvref_t<decltype(callback)> handler{std::move(callback)};
             lock.unlock();
             /* this is executor context so we directly invoke the handler */
-            callback(std::move(res));
+            handler(std::move(res));
             lock.lock();
             /* since we are relying on edge-triggered notifications 
                 we do not remove interest in write events from epoll */
@@ -785,6 +1326,38 @@ HandleSend(std::unique_lock<MutexType>& lock) noexcept
     }
 }
 
+template <typename Protocol, class Executor>
+template <typename KernelOperation>
+inline void BasicStreamSocket<Protocol, Executor>::
+HandleKernelTransfer(KernelOperation& operation, std::unique_lock<MutexType>& lock) noexcept
+{
+    ASRT_LOG_TRACE("[StreamSocket]: Handling sockfd {} {}", this->GetNativeHandle(), operation.OperationTypeStr());
+    assert(Base::IsNonBlocking());
+
+    auto on_immediate_completion{
+        [&lock](auto&& callback, Result<std::size_t>&& res){
+            ASRT_LOG_TRACE("Notifying kernel transfer completion");
+            /* take the handler out of the operation, it may start the next transfer */
+            std::remove_cvref_t<decltype(callback)> handler{std::move(callback)};
+            lock.unlock();
+            /* this is executor context so we directly invoke the handler */
+            handler(std::move(res));
+            lock.lock();
+        }
+    };
+
+    const auto op_status{
+        operation.Perform(
+            Base::GetNativeHandle(), std::move(on_immediate_completion))};
+
+    if(op_status != OperationStatus::kComplete){
+        if constexpr (std::is_same_v<KernelOperation, SpliceReceiveOperation>)
+            Base::AsyncReadOperationStarted();
+        else
+            Base::AsyncWriteOperationStarted();
+    }
+}
+
 template <typename Protocol, class Executor>
 inline void BasicStreamSocket<Protocol, Executor>::
 HandleReceive(std::unique_lock<MutexType>& lock) noexcept
@@ -795,9 +1368,11 @@ HandleReceive(std::unique_lock<MutexType>& lock) noexcept
     auto on_immediate_completion{
         [this, &lock](auto&& callback, ReceiveResult&& res){
             ASRT_LOG_TRACE("Notifying receive completion");
+            /* take the handler out of the operation, it may start the next receive */
+            std::remove_cvref_t<decltype(callback)> handler{std::move(callback)};
             lock.unlock();
             /* this is executor context so we directly invoke the handler */
-            callback(std::move(res));
+            handler(std::move(res));
             lock.lock();
             /* since we are relying on edge-triggered notifications 
                 we do not remove interest in read events from epoll */
@@ -186,7 +186,6 @@ struct TCP : Protocol<TCP>
     template <typename Executor>
     using AcceptorType = Socket::BasicAcceptorSocket<TCP, Executor>;
 
-    constexpr explicit TCP() = default;
     /**
      * @param protocol_family AF_INET / AF_INET6
     */
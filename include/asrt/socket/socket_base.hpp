@@ -34,12 +34,14 @@ public:
     using DoNotRoute = SockOption::BoolOption<SOL_SOCKET, SO_DONTROUTE>;  
     using KeepAlive = SockOption::BoolOption<SOL_SOCKET, SO_KEEPALIVE>;  
     using ReuseAddress = SockOption::BoolOption<SOL_SOCKET, SO_REUSEADDR>;  
+    using ReusePort = SockOption::BoolOption<SOL_SOCKET, SO_REUSEPORT>;
     using OutofBandInline = SockOption::BoolOption<SOL_SOCKET, SO_OOBINLINE>;  
     using SendBuffSize = SockOption::IntOption<SOL_SOCKET, SO_SNDBUF>;  
     using SendLowWatermark = SockOption::IntOption<SOL_SOCKET, SO_SNDLOWAT>;  
     using RecvBuffSize = SockOption::IntOption<SOL_SOCKET, SO_RCVBUF>;  
     using RecvLowWatermark = SockOption::IntOption<SOL_SOCKET, SO_RCVLOWAT>;
     using SocketError = SockOption::IntOption<SOL_SOCKET, SO_ERROR>;
+    using ZeroCopy = SockOption::BoolOption<SOL_SOCKET, SO_ZEROCOPY>;
 
     /**
      * @brief Maximum length of pending incoming connection queue
@@ -0,0 +1,270 @@
+#ifndef C10E9602_C31F_45D2_A1ED_A71B40F776A4
+#define C10E9602_C31F_45D2_A1ED_A71B40F776A4
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <utility>
+#include <functional>
+
+#include "asrt/common_types.hpp"
+#include "asrt/error_code.hpp"
+#include "asrt/socket/types.hpp"
+#include "asrt/sys/syscall.hpp"
+#include "asrt/util.hpp"
+
+namespace Socket{
+
+using namespace Util::Expected_NS;
+using asrt::Result;
+
+namespace details
+{
+    static constexpr std::size_t kDefaultPipeCapacity{std::size_t{1u} << 16u}; /* linux default, 16 pages */
+
+    enum class SpliceState : std::uint8_t
+    {
+        kClosed,
+        kIdle,
+        kRunning,
+        kDone
+    };
+}
+
+/**
+ * @brief Relays the byte stream received on one stream socket to another through a kernel pipe
+ * @details Received data is spliced from the source socket into the pipe as soon as it arrives and
+ *  from the pipe into the destination socket as soon as that is writable, so relayed bytes never
+ *  enter user space. At most one pipe capacity is in flight. Once the source reaches end of file the
+ *  destination is shut down for sending, which propagates the half-close to its peer, and the
+ *  handler is passed the number of bytes relayed. A splicer relays a single stream and cannot be restarted.
+ *
+ * @tparam StreamSocket eg: Tcp::Socket. Both sockets must be connected and non-blocking.
+ * @warning The splicer and both sockets must outlive the relay
+ */
+template <typename StreamSocket>
+class Splicer{
+public:
+    using CompletionHandler = std::function<void(Result<std::size_t>&&)>;
+
+    Splicer(StreamSocket& from, StreamSocket& to) noexcept
+        : from_{from}, to_{to} {}
+
+    /* non-copyable and non-movable, pending operations refer to it */
+    Splicer(Splicer const&) = delete;
+    Splicer(Splicer&&) = delete;
+    Splicer& operator=(Splicer const&) = delete;
+    Splicer& operator=(Splicer&&) = delete;
+
+    ~Splicer() noexcept
+    {
+        this->ClosePipe();
+    }
+
+    /**
+     * @brief Create the pipe used as the kernel side relay buffer
+     *
+     * @param pipe_capacity rounded up by the kernel, limited to /proc/sys/fs/pipe-max-size for unprivileged processes
+     * @return Result<void>
+     */
+    auto Open(std::size_t pipe_capacity = Socket::details::kDefaultPipeCapacity) noexcept -> Result<void>
+    {
+        if(this->state_ != Socket::details::SpliceState::kClosed) [[unlikely]]
+            return MakeUnexpected(asrt::ErrorCodeType::api_error);
+
+        return OsAbstraction::Pipe(O_NONBLOCK | O_CLOEXEC)
+            .and_then([this, pipe_capacity](std::array<int, 2> fds){
+                this->pipe_ = fds;
+                return OsAbstraction::SetPipeCapacity(fds[1], pipe_capacity);
+            })
+            .map([this](std::size_t capacity){
+                this->chunk_size_ = capacity;
+                this->state_ = Socket::details::SpliceState::kIdle;
+            })
+            .map_error([this](asrt::ErrorCodeType ec){
+                this->ClosePipe();
+                return ec;
+            });
+    }
+
+    /**
+     * @brief Start relaying until the source reaches end of file or an error occurs
+     *
+     * @tparam Handler void(Result<std::size_t>&&)
+     * @param handler invoked in executor context with the number of bytes relayed
+     * @return Result<void> api_error if not opened or already started
+     */
+    template <typename Handler>
+    auto StartAsync(Handler&& handler) noexcept -> Result<void>
+    {
+        if(this->state_ != Socket::details::SpliceState::kIdle) [[unlikely]]
+            return MakeUnexpected(asrt::ErrorCodeType::api_error);
+
+        this->state_ = Socket::details::SpliceState::kRunning;
+        this->handler_ = std::forward<Handler>(handler);
+        this->ReceiveChunk();
+        return Result<void>{};
+    }
+
+    std::size_t BytesTransferred() const noexcept { return this->bytes_transferred_.load(std::memory_order_relaxed); }
+
+    bool IsRunning() const noexcept { return this->state_ == Socket::details::SpliceState::kRunning; }
+
+private:
+    void ReceiveChunk() noexcept
+    {
+        this->from_.SpliceReceiveAsync(this->pipe_[1], this->chunk_size_,
+            [this](Result<std::size_t>&& result){
+                if(result.has_value()) [[likely]] {
+                    this->SendChunk(result.value());
+                }else if(result.error() == asrt::ErrorCodeType::end_of_file){
+                    ASRT_LOG_TRACE("[Splicer]: Source reached end of file, shutting down destination");
+                    this->Finish(this->to_.Shutdown(Types::ShutdownType::kDisableTx)
+                        .map([this](){ return this->BytesTransferred(); }));
+                }else [[unlikely]] {
+                    this->Finish(MakeUnexpected(result.error()));
+                }
+            });
+    }
+
+    void SendChunk(std::size_t chunk) noexcept
+    {
+        this->to_.SpliceSendAsync(this->pipe_[0], chunk,
+            [this](Result<std::size_t>&& result){
+                if(result.has_value()) [[likely]] {
+                    this->bytes_transferred_.fetch_add(result.value(), std::memory_order_relaxed);
+                    this->ReceiveChunk();
+                }else [[unlikely]] {
+                    this->Finish(MakeUnexpected(result.error()));
+                }
+            });
+    }
+
+    void Finish(Result<std::size_t>&& result) noexcept
+    {
+        ASRT_LOG_DEBUG("[Splicer]: Relay finished after {} bytes", this->BytesTransferred());
+        this->state_ = Socket::details::SpliceState::kDone;
+        /* the handler may destroy the splicer */
+        CompletionHandler handler{std::move(this->handler_)};
+        handler(std::move(result));
+    }
+
+    void ClosePipe() noexcept
+    {
+        for(int& fd : this->pipe_){
+            if(fd != -1) static_cast<void>(OsAbstraction::Close(std::exchange(fd, -1)));
+        }
+    }
+
+    StreamSocket& from_;
+    StreamSocket& to_;
+    std::array<int, 2> pipe_{-1, -1};
+    std::size_t chunk_size_{Socket::details::kDefaultPipeCapacity};
+    Socket::details::SpliceState state_{Socket::details::SpliceState::kClosed};
+    std::atomic<std::size_t> bytes_transferred_{0u};
+    CompletionHandler handler_{};
+};
+
+/**
+ * @brief Full duplex relay between two stream sockets (eg: an L4 proxy) built on a Splicer per direction
+ * @details Each direction ends with a half-close of its destination once its source reaches end of file,
+ *  the other direction keeps flowing. If either direction fails both sockets are shut down so that the
+ *  other direction ends as well. The handler is invoked once both directions have ended, with the
+ *  first error encountered if any.
+ *
+ * @tparam StreamSocket eg: Tcp::Socket. Both sockets must be connected and non-blocking.
+ * @warning The relay and both sockets must outlive the relay operation
+ */
+template <typename StreamSocket>
+class SpliceRelay{
+public:
+    using CompletionHandler = std::function<void(Result<void>&&)>;
+
+    SpliceRelay(StreamSocket& a, StreamSocket& b) noexcept
+        : a_{a}, b_{b}, forward_{a, b}, backward_{b, a} {}
+
+    SpliceRelay(SpliceRelay const&) = delete;
+    SpliceRelay(SpliceRelay&&) = delete;
+    SpliceRelay& operator=(SpliceRelay const&) = delete;
+    SpliceRelay& operator=(SpliceRelay&&) = delete;
+
+    /**
+     * @brief Create the pipes of both directions
+     *
+     * @param pipe_capacity per direction
+     * @return Result<void>
+     */
+    auto Open(std::size_t pipe_capacity = Socket::details::kDefaultPipeCapacity) noexcept -> Result<void>
+    {
+        return this->forward_.Open(pipe_capacity)
+            .and_then([this, pipe_capacity](){ return this->backward_.Open(pipe_capacity); });
+    }
+
+    /**
+     * @brief Start relaying in both directions
+     *
+     * @tparam Handler void(Result<void>&&)
+     * @param handler invoked in executor context once both directions have ended
+     * @return Result<void> api_error if not opened or already started
+     */
+    template <typename Handler>
+    auto StartAsync(Handler&& handler) noexcept -> Result<void>
+    {
+        if(this->forward_.IsRunning() || this->backward_.IsRunning()) [[unlikely]]
+            return MakeUnexpected(asrt::ErrorCodeType::api_error);
+
+        this->handler_ = std::forward<Handler>(handler);
+        this->directions_running_.store(2u, std::memory_order_relaxed);
+        return this->forward_.StartAsync([this](Result<std::size_t>&& result){
+                this->OnDirectionFinished(this->forward_result_, std::move(result));
+            })
+            .and_then([this](){
+                return this->backward_.StartAsync([this](Result<std::size_t>&& result){
+                    this->OnDirectionFinished(this->backward_result_, std::move(result));
+                });
+            });
+    }
+
+    /**
+     * @brief Bytes relayed from the first to the second socket
+     */
+    std::size_t BytesFromFirst() const noexcept { return this->forward_.BytesTransferred(); }
+
+    /**
+     * @brief Bytes relayed from the second to the first socket
+     */
+    std::size_t BytesFromSecond() const noexcept { return this->backward_.BytesTransferred(); }
+
+private:
+    void OnDirectionFinished(Result<void>& slot, Result<std::size_t>&& result) noexcept
+    {
+        if(!result.has_value()) [[unlikely]] {
+            ASRT_LOG_DEBUG("[SpliceRelay]: Direction failed with {}, shutting down both sockets", result.error());
+            slot = MakeUnexpected(result.error());
+            static_cast<void>(this->a_.Shutdown(Types::ShutdownType::kDisableTxRx));
+            static_cast<void>(this->b_.Shutdown(Types::ShutdownType::kDisableTxRx));
+        }
+
+        /* the last direction to finish reports */
+        if(this->directions_running_.fetch_sub(1u, std::memory_order_acq_rel) == 1u){
+            Result<void> relay_result{this->forward_result_.has_value() ?
+                std::move(this->backward_result_) : std::move(this->forward_result_)};
+            CompletionHandler handler{std::move(this->handler_)};
+            handler(std::move(relay_result));
+        }
+    }
+
+    StreamSocket& a_;
+    StreamSocket& b_;
+    Splicer<StreamSocket> forward_;
+    Splicer<StreamSocket> backward_;
+    Result<void> forward_result_{};
+    Result<void> backward_result_{};
+    std::atomic<std::uint8_t> directions_running_{0u};
+    CompletionHandler handler_{};
+};
+
+} //end ns Socket
+
+#endif /* C10E9602_C31F_45D2_A1ED_A71B40F776A4 */
@@ -202,6 +202,9 @@ namespace Socket
             kSend,
             kReceive,
             kConnect,
+            kSendFile,
+            kSpliceReceive, /* socket to pipe */
+            kSpliceSend, /* pipe to socket */
             kOpTypeMax
         };
 
@@ -215,7 +218,58 @@ namespace Socket
         {
             kOpModeNone = 0u,
             kSpeculative = 0x01u, 
-            kExhaustive = 0x02u
+            kExhaustive = 0x02u,
+            kZeroCopy = 0x04u /* send with MSG_ZEROCOPY */
+        };
+
+        /**
+         * @brief A byte range of a file to be transmitted by the kernel, see BasicStreamSocket::SendFileAsync()
+         * @details Advances like a buffer view as the transfer progresses
+         */
+        struct FileRegion
+        {
+            int fd_{-1};
+            ::off_t offset_{};
+            std::size_t length_{};
+
+            constexpr std::size_t size() const noexcept { return this->length_; }
+
+            constexpr void Advance(std::size_t n) noexcept
+            {
+                this->offset_ += static_cast<::off_t>(n);
+                this->length_ -= n;
+            }
+        };
+
+        /**
+         * @brief Up to length_ bytes to be moved between a socket and the pipe fd_ with splice(2)
+         * @details Advances like a buffer view as the transfer progresses
+         */
+        struct PipeRegion
+        {
+            int fd_{-1};
+            std::size_t length_{};
+
+            constexpr std::size_t size() const noexcept { return this->length_; }
+
+            constexpr void Advance(std::size_t n) noexcept
+            {
+                this->length_ -= n;
+            }
+        };
+
+        /**
+         * @brief A MSG_ZEROCOPY completion read from the socket error queue
+         * @details The kernel numbers every successful zero-copy send call on a socket, 
+         *  starting from 0, and reports the calls whose buffers it released as a range.
+         */
+        struct ZeroCopyNotification
+        {
+            std::uint32_t first_; /* first completed send call */
+            std::uint32_t last_; /* last completed send call, inclusive */
+            bool copied_; /* the kernel fell back to copying the data, eg: on loopback */
+
+            constexpr std::uint32_t Count() const noexcept { return this->last_ - this->first_ + 1u; }
         };
 
         enum class OperationStatus : std::uint8_t
@@ -229,7 +283,10 @@ namespace Socket
         {
             "Send",
             "Receive",
-            "Connect"
+            "Connect",
+            "SendFile",
+            "SpliceReceive",
+            "SpliceSend"
         };
 
         constexpr inline auto 
@@ -0,0 +1,591 @@
+#ifndef C5D09204_4B2C_4C9D_BF19_FC738FC1D8F8
+#define C5D09204_4B2C_4C9D_BF19_FC738FC1D8F8
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <condition_variable>
+#include <array>
+#include <span>
+#include <vector>
+#include <cassert>
+#include <utility>
+#include <functional>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "asrt/common_types.hpp"
+#include "asrt/error_code.hpp"
+#include "asrt/netbuffer.hpp"
+#include "asrt/socket/socket_option.hpp"
+#include "asrt/util.hpp"
+
+namespace Socket{
+
+using namespace Util::Expected_NS;
+using asrt::Result;
+
+/**
+ * @brief What a write that would take the unsent data above the high watermark does
+ */
+enum class OverflowPolicy : std::uint8_t
+{
+    kDropOldest, /* discard the oldest writes not yet handed to the socket to make room */
+    kDisconnect, /* reject the write and fail the coalescer with no_buffer_space */
+    kBlock       /* block the writing thread until the unsent data drained to the low watermark */
+};
+
+struct WriteCoalescerOptions
+{
+    /* pending bytes at which a flush starts right away rather than at the end of the executor turn */
+    std::size_t flush_threshold_{std::size_t{1u} << 16u};
+    /* unsent bytes at which the coalescer stops being writable */
+    std::size_t high_watermark_{std::size_t{4u} << 20u};
+    /* unsent bytes at or below which the coalescer is writable again, must not exceed the high watermark */
+    std::size_t low_watermark_{std::size_t{1u} << 20u};
+    OverflowPolicy overflow_policy_{OverflowPolicy::kDisconnect};
+    /* shared buffers smaller than this are copied like other writes, gathering them would cost more than the copy */
+    std::size_t copy_threshold_{1024u};
+    /* hold partial segments back with TCP_CORK while a flush is in progress, TCP sockets only */
+    bool cork_{false};
+};
+
+struct WriteCoalescerStatistics
+{
+    std::size_t writes_{0u};  /* Write() calls accepted */
+    std::size_t shared_writes_{0u}; /* writes queued by reference instead of being copied */
+    std::size_t flushes_{0u}; /* sends issued, each starting with a single send syscall */
+    std::size_t bytes_{0u};   /* bytes handed to the socket */
+    std::size_t high_watermark_hits_{0u}; /* times the coalescer stopped being writable */
+    std::size_t dropped_writes_{0u}; /* writes discarded by OverflowPolicy::kDropOldest */
+    std::size_t dropped_bytes_{0u};
+
+    double BytesPerFlush() const noexcept
+    {
+        return this->flushes_ == 0u ? 0.0 :
+            static_cast<double>(this->bytes_) / static_cast<double>(this->flushes_);
+    }
+};
+
+/**
+ * @brief Collects the writes issued to a stream socket within one executor turn and sends them together
+ * @details Each Write() copies its data to the pending buffer, except for large pooled buffers, which are 
+ *  queued by reference and gathered with the copied data by the send. A header and its body may be queued 
+ *  as a single write, copied data followed by a pooled buffer, so that they leave with one vectored send 
+ *  and are never separated by the overflow policy. The first write of a turn posts a flush
+ *  to the executor, which runs once the jobs already queued have been executed, so that all the writes of
+ *  the turn leave with a single send. A flush starts right away once the pending data reaches the flush
+ *  threshold. Writes issued while a flush is in progress are sent by the next flush as soon as the current
+ *  one completes, so that data is written in order and at most one send is outstanding on the socket.
+ *  Once a send fails all pending data is dropped, the error handler is invoked and further writes are rejected.
+ *
+ *  The unsent data is bounded by the high watermark. Reaching it makes the coalescer unwritable, producers
+ *  honouring IsWritable() hold back until the writable handler reports that the unsent data drained to the
+ *  low watermark. A write that does not fit below the high watermark is dealt with by the overflow policy.
+ *
+ * @tparam StreamSocket eg: Tcp::Socket. Must be connected and non-blocking.
+ * @note Thread safe. The socket must not be used for other sends while the coalescer is in use.
+ * @warning The coalescer must outlive its posted flush and the send in progress
+ */
+template <typename StreamSocket>
+class WriteCoalescer{
+public:
+    using ExecutorType = typename StreamSocket::ExecutorType;
+    using ErrorHandler = std::function<void(asrt::ErrorCodeType)>;
+    using WritableHandler = std::function<void()>;
+
+    WriteCoalescer(StreamSocket& socket, ExecutorType& executor, WriteCoalescerOptions options = {}) noexcept
+        : socket_{socket}, executor_{executor}, options_{options} 
+    {
+        assert(options.low_watermark_ <= options.high_watermark_);
+    }
+
+    /* non-copyable and non-movable, posted flushes refer to it */
+    WriteCoalescer(WriteCoalescer const&) = delete;
+    WriteCoalescer(WriteCoalescer&&) = delete;
+    WriteCoalescer& operator=(WriteCoalescer const&) = delete;
+    WriteCoalescer& operator=(WriteCoalescer&&) = delete;
+    ~WriteCoalescer() noexcept = default;
+
+    /**
+     * @brief Set the handler invoked in executor context when a send fails
+     */
+    void SetErrorHandler(ErrorHandler handler) noexcept
+    {
+        std::scoped_lock const lock{this->mutex_};
+        this->error_handler_ = std::move(handler);
+    }
+
+    /**
+     * @brief Set the handler invoked in executor context once the unsent data drained to the low watermark
+     *  after the coalescer had stopped being writable
+     */
+    void SetWritableHandler(WritableHandler handler) noexcept
+    {
+        std::scoped_lock const lock{this->mutex_};
+        this->writable_handler_ = std::move(handler);
+    }
+
+    /**
+     * @brief Queue data for sending. Returns without waiting for the data to be sent, 
+     *  unless the data does not fit and the overflow policy is OverflowPolicy::kBlock.
+     *
+     * @param data copied, may be released once the function returns
+     * @return Result<void> the error of the failed send if the coalescer failed before,
+     *  no_buffer_space if rejected by OverflowPolicy::kDisconnect,
+     *  would_block if OverflowPolicy::kBlock would block in executor context, 
+     *  no_memory if the data could not be buffered
+     */
+    auto Write(Buffer::ConstBufferView data) noexcept -> Result<void>
+    {
+        std::unique_lock lock{this->mutex_};
+        if(auto const result{this->Admit(data.size(), lock)}; not result.has_value() || data.size() == 0u)
+            return result;
+
+        if(auto const result{this->QueueCopy({&data, 1u}, data.size())}; not result.has_value()) [[unlikely]]
+            return result;
+        this->OnWriteQueued();
+        return Result<void>{};
+    }
+
+    /**
+     * @brief Queue data gathered from several buffers as a single write, eg: a message header and its body
+     *
+     * @param pieces copied in order, may be released once the function returns
+     * @return Result<void> see Write(Buffer::ConstBufferView)
+     */
+    auto Write(std::span<Buffer::ConstBufferView const> pieces) noexcept -> Result<void>
+    {
+        std::size_t size{0u};
+        for(Buffer::ConstBufferView const& piece : pieces)
+            size += piece.size();
+
+        std::unique_lock lock{this->mutex_};
+        if(auto const result{this->Admit(size, lock)}; not result.has_value() || size == 0u)
+            return result;
+
+        if(auto const result{this->QueueCopy(pieces, size)}; not result.has_value()) [[unlikely]]
+            return result;
+        this->OnWriteQueued();
+        return Result<void>{};
+    }
+
+    /**
+     * @brief Queue a pooled buffer for sending by reference, eg: the same encoded message written to many sockets. 
+     *  Buffers smaller than the copy threshold are copied instead.
+     *
+     * @param data kept until sent, must not be modified meanwhile
+     * @return Result<void> see Write(Buffer::ConstBufferView)
+     */
+    auto Write(Buffer::PooledBuffer data) noexcept -> Result<void>
+    {
+        return this->Write(Buffer::ConstBufferView{}, std::move(data));
+    }
+
+    /**
+     * @brief Queue a copy of header followed by a pooled buffer sent by reference as a single write, 
+     *  eg: an encoded message header and a body received or built in pooled memory
+     *
+     * @param header copied, may be released once the function returns
+     * @param data kept until sent, must not be modified meanwhile. Copied as well if smaller than the copy threshold.
+     * @return Result<void> see Write(Buffer::ConstBufferView)
+     */
+    auto Write(Buffer::ConstBufferView header, Buffer::PooledBuffer data) noexcept -> Result<void>
+    {
+        std::unique_lock lock{this->mutex_};
+        std::size_t const size{header.size() + data.size()};
+        if(auto const result{this->Admit(size, lock)}; not result.has_value() || size == 0u)
+            return result;
+
+        if(data.size() < this->options_.copy_threshold_){
+            std::array<Buffer::ConstBufferView, 2u> const pieces{header, data.View()};
+            if(auto const result{this->QueueCopy(pieces, size)}; not result.has_value()) [[unlikely]]
+                return result;
+            this->OnWriteQueued();
+            return Result<void>{};
+        }
+
+        if(auto const result{this->CopyToPending({&header, 1u}, header.size())}; not result.has_value()) [[unlikely]]
+            return result;
+        this->pending_writes_.push_back(PendingWrite{size, header.size(), std::move(data)});
+        this->pending_bytes_ += size;
+        ++this->pending_shared_;
+        ++this->statistics_.shared_writes_;
+        this->OnWriteQueued();
+        return Result<void>{};
+    }
+
+    /**
+     * @brief Start sending the pending data now unless a flush is already in progress
+     */
+    void Flush() noexcept
+    {
+        std::scoped_lock const lock{this->mutex_};
+        this->flush_scheduled_ = false;
+        if(not this->flush_in_progress_ && this->pending_bytes_ != 0u)
+            this->StartFlush();
+    }
+
+    /**
+     * @brief Bytes written but not yet handed to the socket
+     */
+    std::size_t PendingBytes() const noexcept
+    {
+        std::scoped_lock const lock{this->mutex_};
+        return this->pending_bytes_;
+    }
+
+    /**
+     * @brief Bytes written but not yet fully sent, including the flush in progress
+     */
+    std::size_t UnsentBytes() const noexcept
+    {
+        std::scoped_lock const lock{this->mutex_};
+        return this->UnsentBytesUnsafe();
+    }
+
+    /**
+     * @brief Whether the unsent data stayed below the high watermark, or drained to the low watermark since
+     */
+    bool IsWritable() const noexcept
+    {
+        std::scoped_lock const lock{this->mutex_};
+        return not this->full_ && this->failure_ == asrt::ErrorCodeType::no_error;
+    }
+
+    /**
+     * @brief Drop all unsent data, statistics and failure state, eg: before the socket is reused for another connection
+     * @details A send still in progress on the previous connection completes without effect. 
+     *  The error and writable handlers are kept.
+     *
+     * @param options applied from now on
+     */
+    void Reset(WriteCoalescerOptions options) noexcept
+    {
+        assert(options.low_watermark_ <= options.high_watermark_);
+        std::scoped_lock const lock{this->mutex_};
+        ++this->generation_;
+        this->options_ = options;
+        this->pending_.Clear();
+        this->in_flight_.Clear();
+        this->pending_writes_.clear();
+        this->in_flight_writes_.clear();
+        this->pending_head_ = 0u;
+        this->pending_bytes_ = this->in_flight_bytes_ = 0u;
+        this->pending_shared_ = 0u;
+        this->flush_in_progress_ = false;
+        this->corked_ = false;
+        this->full_ = false;
+        this->failure_ = asrt::ErrorCodeType::no_error;
+        this->statistics_ = {};
+        this->writable_cv_.notify_all();
+    }
+
+    WriteCoalescerOptions const& GetOptions() const noexcept { return this->options_; }
+
+    WriteCoalescerStatistics GetStatistics() const noexcept
+    {
+        std::scoped_lock const lock{this->mutex_};
+        return this->statistics_;
+    }
+
+private:
+    using MutexType = typename StreamSocket::MutexType;
+    using Cork = SockOption::BoolOption<IPPROTO_TCP, TCP_CORK>;
+
+    struct PendingWrite
+    {
+        std::size_t size_;
+        std::size_t copied_; /* bytes in the pending buffer, sent ahead of shared_ */
+        Buffer::PooledBuffer shared_{}; /* empty if all the data was copied to the pending buffer */
+    };
+
+    std::size_t UnsentBytesUnsafe() const noexcept
+    {
+        return this->pending_bytes_ + this->in_flight_bytes_;
+    }
+
+    /**
+     * @brief Check whether a write of size bytes may be queued, making room for it according to the overflow policy
+     */
+    auto Admit(std::size_t size, std::unique_lock<MutexType>& lock) noexcept -> Result<void>
+    {
+        if(this->failure_ != asrt::ErrorCodeType::no_error) [[unlikely]]
+            return MakeUnexpected(this->failure_);
+        if(size != 0u && this->UnsentBytesUnsafe() + size > this->options_.high_watermark_) [[unlikely]]
+            return this->HandleOverflow(size, lock);
+        return Result<void>{};
+    }
+
+    /* lock must be held */
+    auto CopyToPending(std::span<Buffer::ConstBufferView const> pieces, std::size_t size) noexcept -> Result<void>
+    {
+        if(size == 0u) return Result<void>{};
+        Buffer::MutableBufferView const space{this->pending_.Prepare(size)};
+        if(space.size() < size) [[unlikely]]
+            return MakeUnexpected(asrt::ErrorCodeType::no_memory);
+        auto* dest{static_cast<std::uint8_t*>(space.data())};
+        for(Buffer::ConstBufferView const& piece : pieces){
+            if(piece.size() == 0u) continue; /* may not point anywhere */
+            std::memcpy(dest, piece.data(), piece.size());
+            dest += piece.size();
+        }
+        this->pending_.Commit(size);
+        return Result<void>{};
+    }
+
+    /* lock must be held */
+    auto QueueCopy(std::span<Buffer::ConstBufferView const> pieces, std::size_t size) noexcept -> Result<void>
+    {
+        if(auto const result{this->CopyToPending(pieces, size)}; not result.has_value()) [[unlikely]]
+            return result;
+        this->pending_writes_.push_back(PendingWrite{size, size});
+        this->pending_bytes_ += size;
+        return Result<void>{};
+    }
+
+    /* lock must be held */
+    void OnWriteQueued() noexcept
+    {
+        ++this->statistics_.writes_;
+
+        if(not this->full_ && this->UnsentBytesUnsafe() >= this->options_.high_watermark_) [[unlikely]]
+            this->SetFull();
+
+        if(this->flush_in_progress_) return; /* picked up once the current flush completes */
+
+        if(this->pending_bytes_ >= this->options_.flush_threshold_){
+            this->StartFlush();
+        }else if(not this->flush_scheduled_){
+            this->flush_scheduled_ = true;
+            this->executor_.Post([this](){ this->Flush(); });
+        }
+    }
+
+    void SetFull() noexcept
+    {
+        ASRT_LOG_DEBUG("[WriteCoalescer]: {} unsent bytes reached the high watermark", this->UnsentBytesUnsafe());
+        this->full_ = true;
+        ++this->statistics_.high_watermark_hits_;
+    }
+
+    /**
+     * @brief Make room for a write of size bytes according to the overflow policy
+     */
+    auto HandleOverflow(std::size_t size, std::unique_lock<MutexType>& lock) noexcept -> Result<void>
+    {
+        if(not this->full_) this->SetFull();
+
+        switch(this->options_.overflow_policy_){
+        case OverflowPolicy::kDropOldest:
+            while(this->pending_head_ < this->pending_writes_.size() && 
+                this->UnsentBytesUnsafe() + size > this->options_.high_watermark_){
+                PendingWrite& oldest{this->pending_writes_[this->pending_head_++]};
+                if(oldest.shared_){
+                    --this->pending_shared_;
+                    oldest.shared_.Reset();
+                }
+                this->pending_.Consume(oldest.copied_);
+                this->pending_bytes_ -= oldest.size_;
+                ++this->statistics_.dropped_writes_;
+                this->statistics_.dropped_bytes_ += oldest.size_;
+            }
+            return Result<void>{}; /* the write itself is kept even if it exceeds the watermark on its own */
+
+        case OverflowPolicy::kBlock:
+            if(this->executor_.IsExecutorContext()) [[unlikely]] {
+                /* the unsent data can only drain in executor context */
+                return MakeUnexpected(asrt::ErrorCodeType::would_block);
+            }
+            this->writable_cv_.wait(lock, [this](){
+                return this->failure_ != asrt::ErrorCodeType::no_error ||
+                    this->UnsentBytesUnsafe() <= this->options_.low_watermark_;
+            });
+            if(this->failure_ != asrt::ErrorCodeType::no_error) [[unlikely]]
+                return MakeUnexpected(this->failure_);
+            return Result<void>{};
+
+        case OverflowPolicy::kDisconnect:
+        default:
+            ASRT_LOG_WARN("[WriteCoalescer]: Consumer too slow, {} bytes unsent. Disconnecting", 
+                this->UnsentBytesUnsafe());
+            this->Fail(asrt::ErrorCodeType::no_buffer_space);
+            if(ErrorHandler handler{this->error_handler_}) [[likely]] {
+                this->executor_.Post([handler = std::move(handler)](){
+                    handler(asrt::ErrorCodeType::no_buffer_space);
+                });
+            }
+            return MakeUnexpected(asrt::ErrorCodeType::no_buffer_space);
+        }
+    }
+
+    /* lock must be held */
+    void Fail(asrt::ErrorCodeType ec) noexcept
+    {
+        this->failure_ = ec;
+        this->pending_.Clear();
+        this->pending_writes_.clear();
+        this->pending_head_ = 0u;
+        this->pending_bytes_ = 0u;
+        this->pending_shared_ = 0u;
+        this->writable_cv_.notify_all();
+    }
+
+    /* lock must be held */
+    void StartFlush() noexcept
+    {
+        std::swap(this->pending_, this->in_flight_); /* both keep their storage across flushes */
+        this->in_flight_bytes_ = std::exchange(this->pending_bytes_, 0u);
+        if(this->pending_shared_ != 0u) [[unlikely]] {
+            /* shared buffers are gathered with the copied data in the order written */
+            std::swap(this->pending_writes_, this->in_flight_writes_);
+            this->pending_shared_ = 0u;
+            this->in_flight_next_ = this->pending_head_; /* skip the writes dropped by the overflow policy */
+            this->in_flight_offset_ = 0u;
+        }
+        this->pending_writes_.clear();
+        this->pending_head_ = 0u;
+        this->flush_in_progress_ = true;
+
+        if(not this->socket_.IsOpen()) [[unlikely]] {
+            this->executor_.Post([this, generation = this->generation_](){
+                this->OnFlushComplete(generation, MakeUnexpected(asrt::ErrorCodeType::bad_descriptor));
+            });
+            return;
+        }
+
+        this->statistics_.bytes_ += this->in_flight_bytes_;
+
+        if(this->options_.cork_ && not this->corked_) [[unlikely]]
+            this->SetCork(true);
+
+        ASRT_LOG_TRACE("[WriteCoalescer]: Flushing {} bytes", this->in_flight_bytes_);
+        this->SendInFlight();
+    }
+
+    /* lock must be held */
+    void SendInFlight() noexcept
+    {
+        ++this->statistics_.flushes_;
+        auto completion{[this, generation = this->generation_](Result<std::size_t> result){
+            this->OnFlushComplete(generation, std::move(result));
+        }};
+
+        /* completion is posted to the executor, never invoked from within SendAsync() */
+        if(this->in_flight_writes_.empty()) [[likely]] {
+            this->socket_.SendAsync(this->in_flight_.Data(), std::move(completion));
+            return;
+        }
+
+        /* copied data is contiguous in the in-flight buffer up to the next shared buffer, each run of it 
+            and each shared buffer takes one view. writes that do not fit the sequence are sent once this send completes */
+        Buffer::ConstBufferSequence sequence;
+        std::size_t const count{this->in_flight_writes_.size()};
+        std::size_t run{0u};
+        auto const push_run{[this, &sequence, &run](){
+            if(run == 0u) return;
+            static_cast<void>(sequence.Push({this->in_flight_.data() + this->in_flight_offset_, run}));
+            this->in_flight_offset_ += run;
+            run = 0u;
+        }};
+        while(this->in_flight_next_ < count){
+            PendingWrite const& write{this->in_flight_writes_[this->in_flight_next_]};
+            std::size_t const views{sequence.Count() + (run != 0u || write.copied_ != 0u ? 1u : 0u) + 
+                (write.shared_ ? 1u : 0u)};
+            if(views > Buffer::ConstBufferSequence::kMaxBuffers) [[unlikely]]
+                break;
+            run += write.copied_;
+            ++this->in_flight_next_;
+            if(write.shared_){
+                push_run();
+                static_cast<void>(sequence.Push(write.shared_.View()));
+            }
+        }
+        push_run();
+        this->socket_.SendAsync(sequence, std::move(completion));
+    }
+
+    void OnFlushComplete(std::uint32_t generation, Result<std::size_t>&& result) noexcept
+    {
+        std::unique_lock lock{this->mutex_};
+        if(generation != this->generation_) [[unlikely]] return; /* flush of a connection reset since */
+        if(result.has_value() && this->in_flight_next_ < this->in_flight_writes_.size()) [[unlikely]] {
+            this->SendInFlight(); /* gathered writes left over by the previous send */
+            return;
+        }
+        this->in_flight_.Clear();
+        this->in_flight_writes_.clear();
+        this->in_flight_bytes_ = 0u;
+        this->flush_in_progress_ = false;
+
+        if(not result.has_value()) [[unlikely]] {
+            if(this->failure_ != asrt::ErrorCodeType::no_error) return; /* already reported */
+            ASRT_LOG_ERROR("[WriteCoalescer]: Send failed with {}, dropping {} pending bytes",
+                result.error(), this->pending_bytes_);
+            this->Fail(result.error());
+            ErrorHandler handler{this->error_handler_};
+            lock.unlock();
+            if(handler) handler(result.error());
+            return;
+        }
+
+        if(this->pending_bytes_ != 0u){
+            this->StartFlush();
+        }else if(this->corked_){
+            this->SetCork(false); /* push out the final partial segment */
+        }
+
+        if(this->full_ && this->UnsentBytesUnsafe() <= this->options_.low_watermark_){
+            ASRT_LOG_DEBUG("[WriteCoalescer]: Unsent bytes drained to the low watermark");
+            this->full_ = false;
+            this->writable_cv_.notify_all();
+            WritableHandler handler{this->writable_handler_};
+            lock.unlock();
+            if(handler) handler();
+        }
+    }
+
+    /* lock must be held */
+    void SetCork(bool enable) noexcept
+    {
+        this->socket_.SetOption(Cork{enable})
+            .map([this, enable](){
+                this->corked_ = enable;
+            })
+            .map_error([this](asrt::ErrorCodeType ec){
+                ASRT_LOG_WARN("[WriteCoalescer]: Unable to toggle TCP_CORK, {}. Disabling cork mode", ec);
+                this->options_.cork_ = false;
+                return ec;
+            });
+    }
+
+    StreamSocket& socket_;
+    ExecutorType& executor_;
+    WriteCoalescerOptions options_;
+    mutable MutexType mutex_;
+    std::condition_variable_any writable_cv_;
+    Buffer::DynamicBuffer pending_{};
+    Buffer::DynamicBuffer in_flight_{};
+    std::vector<PendingWrite> pending_writes_{}; /* oldest first, both keep their storage across flushes */
+    std::vector<PendingWrite> in_flight_writes_{}; /* only kept while shared buffers are in flight */
+    std::size_t pending_head_{0u}; /* pending writes before it were dropped by the overflow policy */
+    std::size_t pending_bytes_{0u}; /* copied and shared */
+    std::size_t in_flight_bytes_{0u};
+    std::size_t pending_shared_{0u}; /* shared buffers among the pending writes */
+    std::size_t in_flight_next_{0u}; /* first in-flight write not yet handed to the socket */
+    std::size_t in_flight_offset_{0u}; /* offset of its copied data in in_flight_ */
+    bool flush_scheduled_{false};
+    bool flush_in_progress_{false};
+    bool corked_{false};
+    bool full_{false};
+    std::uint32_t generation_{0u}; /* incremented by Reset() */
+    asrt::ErrorCodeType failure_{asrt::ErrorCodeType::no_error};
+    WriteCoalescerStatistics statistics_{};
+    ErrorHandler error_handler_{};
+    WritableHandler writable_handler_{};
+};
+
+} //end ns Socket
+
+#endif /* C5D09204_4B2C_4C9D_BF19_FC738FC1D8F8 */
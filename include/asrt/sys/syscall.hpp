@@ -3,6 +3,8 @@
 
 #include "asrt/config.hpp"
 #include <cstdint>
+#include <algorithm>
+#include <array>
 #include <csignal>
 #include <sys/signalfd.h> //todo
 #include <string>
@@ -24,7 +26,11 @@
 #endif
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <sys/uio.h>
+#include <sys/sendfile.h>
 #include <sys/ioctl.h>
+#include <netinet/in.h>
+#include <linux/errqueue.h>
 #include <net/if.h>
 #include <linux/if_ether.h>
 #include <sys/timerfd.h>
@@ -562,6 +568,236 @@ inline auto ReceiveWithFlags(int sockfd, MutableBufferView buf, int flags = 0) n
     }
 }
 
+/**
+ * @brief Gather-send all views of a buffer sequence with a single ::sendmsg()
+ * 
+ * @param sockfd 
+ * @param seq buffer sequence, eg: ConstBufferSequence
+ * @param flags see Send()
+ * @return Result<std::size_t> number of bytes sent, which may end in the middle of any view
+ */
+template<typename BufferSequence>
+inline auto SendVectored(int sockfd, BufferSequence const& seq, int flags = 0) noexcept -> Result<std::size_t>
+{
+    static_assert(BufferViewTraits::is_sequence<BufferSequence>::value, "Invalid buffer sequence passed to sendmsg()");
+    ASRT_LOG_TRACE("Sending {} bytes of data in {} buffers on sockfd {}", seq.size(), seq.Count(), sockfd);
+
+    ::msghdr msg{};
+    msg.msg_iov = const_cast<::iovec*>(seq.Iovecs());
+    msg.msg_iovlen = seq.Count();
+
+    for(;;)
+    {
+        ::ssize_t const sent_bytes{::sendmsg(sockfd, &msg, flags)};
+
+        if(sent_bytes >= 0) [[likely]] {
+            return Result<std::size_t>{sent_bytes};
+        }else if(errno == EINTR) {
+            continue;
+        }else [[unlikely]] {
+            return MakeUnexpected(MapAndLogSysError("::sendmsg()"));
+        }
+    }
+}
+
+/**
+ * @brief Transmit (part of) a file region on a socket without passing the data through user space
+ * @details The file offset of region.fd_ is left untouched. Blocks only if sockfd is blocking.
+ * 
+ * @param sockfd 
+ * @param region the file and byte range to send
+ * @return Result<std::size_t> number of bytes sent; 0 if the file ends before the region
+ */
+inline auto SendFile(int sockfd, Socket::Types::FileRegion const& region) noexcept -> Result<std::size_t>
+{
+    ASRT_LOG_TRACE("Sending {} bytes of file fd {} at offset {} on sockfd {}", 
+        region.size(), region.fd_, region.offset_, sockfd);
+
+    ::off_t offset{region.offset_};
+    /* sendfile() transfers at most 0x7ffff000 bytes per call */
+    std::size_t const count{std::min<std::size_t>(region.size(), 0x7ffff000u)};
+
+    ::ssize_t const sent_bytes{TEMP_FAILURE_RETRY(::sendfile(sockfd, region.fd_, &offset, count))};
+    if(sent_bytes == -1) [[unlikely]]
+        return MakeUnexpected(MapAndLogSysError("::sendfile()"));
+    return Result<std::size_t>{static_cast<std::size_t>(sent_bytes)};
+}
+
+/**
+ * @brief Create a pipe
+ * 
+ * @param flags O_NONBLOCK, O_CLOEXEC, O_DIRECT
+ * @return Result<std::array<int, 2>> read end at [0], write end at [1]
+ */
+inline auto Pipe(int flags = O_CLOEXEC) noexcept -> Result<std::array<int, 2>>
+{
+    std::array<int, 2> fds{-1, -1};
+    if(::pipe2(fds.data(), flags) == -1) [[unlikely]]
+        return MakeUnexpected(MapAndLogSysError("::pipe2()"));
+    ASRT_LOG_TRACE("Created pipe, read fd {}, write fd {}", fds[0], fds[1]);
+    return fds;
+}
+
+/**
+ * @brief Resize the buffer of a pipe
+ * 
+ * @param pipefd either end of the pipe
+ * @param capacity rounded up to a power of two number of pages by the kernel
+ * @return Result<std::size_t> the actual capacity
+ */
+inline auto SetPipeCapacity(int pipefd, std::size_t capacity) noexcept -> Result<std::size_t>
+{
+    int const actual{::fcntl(pipefd, F_SETPIPE_SZ, static_cast<int>(capacity))};
+    if(actual == -1) [[unlikely]]
+        return MakeUnexpected(MapAndLogSysError("::fcntl(F_SETPIPE_SZ)"));
+    return Result<std::size_t>{static_cast<std::size_t>(actual)};
+}
+
+/**
+ * @brief Move up to length bytes between a pipe and another file descriptor inside the kernel
+ * @details One of fd_in and fd_out must be a pipe. Pages are moved rather than copied where possible.
+ * 
+ * @param fd_in 
+ * @param fd_out 
+ * @param length 
+ * @param flags SPLICE_F_MOVE, SPLICE_F_NONBLOCK, SPLICE_F_MORE
+ * @return Result<std::size_t> number of bytes moved; 0 if fd_in reached end of file
+ */
+inline auto Splice(int fd_in, int fd_out, std::size_t length, unsigned int flags) noexcept -> Result<std::size_t>
+{
+    ASRT_LOG_TRACE("Splicing {} bytes from fd {} to fd {}", length, fd_in, fd_out);
+
+    ::ssize_t const moved_bytes{TEMP_FAILURE_RETRY(::splice(fd_in, nullptr, fd_out, nullptr, length, flags))};
+    if(moved_bytes == -1) [[unlikely]]
+        return MakeUnexpected(MapAndLogSysError("::splice()"));
+    return Result<std::size_t>{static_cast<std::size_t>(moved_bytes)};
+}
+
+/**
+ * @brief Dequeue one message from the socket error queue and decode it as a MSG_ZEROCOPY completion
+ * @details Never blocks. See linux Documentation/networking/msg_zerocopy.rst
+ * 
+ * @param sockfd 
+ * @return Result<Optional<ZeroCopyNotification>> empty if the dequeued message was not a zero-copy 
+ *  completion; try_again once the error queue is drained
+ */
+inline auto ReceiveZeroCopyNotification(int sockfd) noexcept 
+    -> Result<Util::Optional_NS::Optional<Socket::Types::ZeroCopyNotification>>
+{
+    using Socket::Types::ZeroCopyNotification;
+    alignas(::cmsghdr) char control[CMSG_SPACE(sizeof(::sock_extended_err)) * 2];
+
+    ::msghdr msg{};
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    if(TEMP_FAILURE_RETRY(::recvmsg(sockfd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT)) == -1) {
+        if(errno == EAGAIN || errno == EWOULDBLOCK) [[likely]]
+            return MakeUnexpected(ErrorCode::try_again); /* drained, nothing to log */
+        return MakeUnexpected(MapAndLogSysError("::recvmsg(MSG_ERRQUEUE)"));
+    }
+
+    for(::cmsghdr* cmsg{CMSG_FIRSTHDR(&msg)}; cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)){
+        bool const is_ip_error{
+            (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+            (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)};
+        if(!is_ip_error) continue;
+
+        ::sock_extended_err serr;
+        std::memcpy(&serr, CMSG_DATA(cmsg), sizeof(serr));
+        if(serr.ee_origin != SO_EE_ORIGIN_ZEROCOPY || serr.ee_errno != 0) continue;
+
+        return ZeroCopyNotification{
+            serr.ee_info, serr.ee_data, (serr.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0};
+    }
+    ASRT_LOG_DEBUG("Dropped non zero-copy error queue message on sockfd {}", sockfd);
+    return Util::Optional_NS::Optional<ZeroCopyNotification>{};
+}
+
+template<typename BufferSequence>
+inline auto SendAllVectored(int sockfd, BufferSequence seq, int flags = 0) noexcept -> Result<void>
+{
+    static_assert(BufferViewTraits::is_sequence<BufferSequence>::value, "Invalid buffer sequence passed to sendmsg()");
+    ASRT_LOG_TRACE("Sending sync {} bytes of data in {} buffers on sockfd {}", seq.size(), seq.Count(), sockfd);
+
+    while(not seq.Empty()){
+        Result<std::size_t> const send_result{SendVectored(sockfd, seq, flags | MSG_NOSIGNAL)};
+        if(not send_result.has_value()) [[unlikely]] {
+            return MakeUnexpected(send_result.error());
+        }
+        seq.Advance(send_result.value()); /* resume from where the kernel stopped */
+    }
+    return Result<void>{};
+}
+
+/**
+ * @brief Scatter-receive into all views of a buffer sequence with a single ::recvmsg()
+ * 
+ * @param sockfd 
+ * @param seq mutable buffer sequence
+ * @param flags see Receive()
+ * @return Result<std::size_t> number of bytes received, filling the views in order
+ */
+template<typename MutableBufferSequence>
+inline auto ReceiveVectored(int sockfd, MutableBufferSequence const& seq, int flags = 0) noexcept -> Result<std::size_t>
+{
+    static_assert(BufferViewTraits::is_sequence<MutableBufferSequence>::value &&
+        BufferViewTraits::is_mutable<MutableBufferSequence>::value, "Invalid buffer sequence passed to recvmsg()");
+    ASRT_LOG_TRACE("Receiving into {} buffers on sockfd {}", seq.Count(), sockfd);
+
+    ::msghdr msg{};
+    msg.msg_iov = const_cast<::iovec*>(seq.Iovecs());
+    msg.msg_iovlen = seq.Count();
+
+    for(;;){
+        ::ssize_t const received_bytes{::recvmsg(sockfd, &msg, flags)};
+
+        if(received_bytes >= 0) [[likely]] {
+            ASRT_LOG_TRACE("Received {} bytes of data on sockfd {}", received_bytes, sockfd);
+            return Result<std::size_t>{received_bytes};
+        }else if(errno == EINTR) {
+            continue;
+        }else [[unlikely]] {
+            return MakeUnexpected(MapAndLogSysError("::recvmsg()"));
+        }
+    }
+}
+
+/* ::writev() for descriptors that are not sockets, eg: pipes and files */
+template<typename BufferSequence>
+inline auto Writev(int fd, BufferSequence const& seq) noexcept -> Result<std::size_t>
+{
+    static_assert(BufferViewTraits::is_sequence<BufferSequence>::value, "Invalid buffer sequence passed to writev()");
+    ASRT_LOG_TRACE("Writing {} bytes of data in {} buffers on fd {}", seq.size(), seq.Count(), fd);
+
+    ::ssize_t const result{
+        TEMP_FAILURE_RETRY(::writev(fd, seq.Iovecs(), static_cast<int>(seq.Count())))};
+    if(result == -1) [[unlikely]]
+    {
+        return MakeUnexpected(MapAndLogSysError("::writev()"));
+    }
+    return Result<std::size_t>{result};
+}
+
+/* ::readv() for descriptors that are not sockets, eg: pipes and files */
+template<typename MutableBufferSequence>
+inline auto Readv(int fd, MutableBufferSequence const& seq) noexcept -> Result<std::size_t>
+{
+    static_assert(BufferViewTraits::is_sequence<MutableBufferSequence>::value &&
+        BufferViewTraits::is_mutable<MutableBufferSequence>::value, "Invalid buffer sequence passed to readv()");
+    ASRT_LOG_TRACE("Reading into {} buffers on fd {}", seq.Count(), fd);
+
+    ::ssize_t const result{
+        TEMP_FAILURE_RETRY(::readv(fd, seq.Iovecs(), static_cast<int>(seq.Count())))};
+    if(result == -1) [[unlikely]]
+    {
+        return MakeUnexpected(MapAndLogSysError("::readv()"));
+    }
+
+    ASRT_LOG_TRACE("Read {} bytes of data on fd {}", result, fd);
+    return Result<std::size_t>{result};
+}
+
 /* ::poll() until socket is ready to write */
 inline auto PollWrite(int sockfd, int timeout) noexcept -> Result<int>
 {
@@ -1214,6 +1450,43 @@ MemoryUnmap(void* addr, std::size_t length) noexcept -> Result<void>
     }
 }
 
+/**
+ * @brief Creates an anonymous file that lives in memory, see man memfd_create(2)
+ * 
+ * @param name name of the file, shown in /proc/self/fd for debugging purposes only
+ * @param flags MFD_CLOEXEC etc.
+ * @return Result<int> file descriptor of the anonymous file
+ */
+[[nodiscard]] inline auto 
+MemfdCreate(const char* name, unsigned int flags = MFD_CLOEXEC) noexcept -> Result<int>
+{
+    ASRT_LOG_TRACE("{}()", __func__);
+
+    int const fd{::memfd_create(name, flags)};
+    if(fd == -1) [[unlikely]]
+        return MakeUnexpected(MapAndLogSysError("::memfd_create()"));
+    else
+        return fd;
+}
+
+/**
+ * @brief Truncates or extends the file referred to by fd to exactly length bytes
+ * 
+ * @param fd 
+ * @param length 
+ * @return Result<void> 
+ */
+inline auto 
+FileTruncate(int fd, ::off_t length) noexcept -> Result<void>
+{
+    ASRT_LOG_TRACE("{}()", __func__);
+
+    if(TEMP_FAILURE_RETRY(::ftruncate(fd, length)) == -1) [[unlikely]]
+        return MakeUnexpected(MapAndLogSysError("::ftruncate()"));
+    else
+        return {};
+}
+
 }//end S
 
 namespace Libc{
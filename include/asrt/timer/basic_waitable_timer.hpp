@@ -8,6 +8,7 @@
 #include <queue>
 
 #include "asrt/common_types.hpp"
+#include "asrt/inplace_function.hpp"
 #include "asrt/timer/timer_types.hpp"
 //#include "asrt/timer/timer_queue.hpp"
 #include "asrt/sys/syscall.hpp"
@@ -70,6 +71,9 @@ public:
      * 
      * @warning Destroying the timer when there are still outstanding async operation 
      *  associated with it is undefined behavior
+     * @note A timer destroyed on a thread of another timer shard than the one it was created on 
+     *  is unregistered asynchronously by its own shard. Expiries that shard has already dispatched 
+     *  are outstanding operations in the above sense.
      */
     ~BasicWaitableTimer() noexcept 
     {
@@ -121,7 +125,7 @@ public:
             timer_period = DurationType{};
         }
 
-        return this->timer_manager_.AddTimer(this->timer_id_, timer_expiry, timer_period)
+        return this->timer_manager_.AddTimer(this->timer_id_, timer_expiry, timer_period, this->slack_)
             .map([this](){
                 this->executor_.OnJobArrival(); /* inform executor of incoming async job */
             });
@@ -132,6 +136,44 @@ public:
         return this->expiry_;
     }
 
+    /**
+     * @brief Allow the timer to fire up to slack later than its expiry. 
+     * @details Timers with overlapping windows are expired by a single reactor wakeup. 
+     *  Takes effect on the next WaitAsync().
+     * 
+     * @param slack 
+     */
+    void SetSlack(DurationType slack) noexcept
+    {
+        this->slack_ = slack;
+    }
+
+    DurationType Slack() const noexcept
+    {
+        return this->slack_;
+    }
+
+    /**
+     * @brief Select what a recurring timer does about periods that elapse before it could be serviced. 
+     * @details Recurring timers fire on absolute deadlines (first expiry + n * period) and do not drift. 
+     *  Takes effect on the next expiry.
+     * 
+     * @param policy 
+     * @return Result<void> 
+     */
+    auto SetCatchUpPolicy(Types::CatchUpPolicy policy) noexcept -> Result<void>
+    {
+        return this->timer_manager_.SetCatchUpPolicy(this->timer_id_, policy);
+    }
+
+    /**
+     * @brief Retrieve missed deadline and lateness counters of this timer
+     */
+    auto Statistics() noexcept -> Result<Types::TimerStatistics>
+    {
+        return this->timer_manager_.GetTimerStatistics(this->timer_id_);
+    }
+
     /**
      * @brief Sets new expiry for the timer. Does not affect periodic timers.
      * 
@@ -166,7 +208,7 @@ public:
     }
 
 private:
-    using Handler = std::function<void()>;
+    using Handler = asrt::InplaceFunction<void(), asrt::config::kTimerHandlerCapacity>; /* rearming reuses the storage */
 
     void OnTimerExpiry(Types::TimerTag timerid) noexcept
     {
@@ -174,7 +216,14 @@ private:
 
         ASRT_LOG_TRACE("[Timer]: On timer expiry"); 
 
-        this->timer_handler_();
+        if constexpr (TimerModeType == TimerMode::kOneShot) {
+            /* the wait is over. move the handler out so that it may call WaitAsync() again */
+            this->async_wait_in_progress_ = false;
+            Handler handler{std::move(this->timer_handler_)};
+            handler();
+        }else{
+            this->timer_handler_();
+        }
     }
 
     /**
@@ -211,6 +260,7 @@ private:
     bool async_wait_in_progress_{false};
     TimePointType expiry_{};
     DurationType period_;
+    DurationType slack_{};
     Handler timer_handler_;
     Timer::Types::TimerTag timer_id_;
 }; // class BasicWaitableTimer
@@ -2,6 +2,7 @@
 #define CF628894_E112_405D_BBAE_DC65E9D9563E
 
 #include <cstdint>
+#include <atomic>
 #include <queue>
 #include <vector>
 #include <algorithm>
@@ -26,6 +27,11 @@ using namespace Util::Expected_NS;
 
 /**
  * @brief A thread-safe implementation of a priority queue for timers
+ * @details The executor keeps one timer queue per shard. Every executor thread is assigned a shard 
+ *  so that timers armed from that thread do not contend with timers armed elsewhere. 
+ *  Expired handlers are posted to the executor in batches and may therefore run on any executor thread. 
+ *  Cancellations issued from threads of other shards are forwarded to the owning shard, 
+ *  which carries them out before it expires anything.
  * 
  * @tparam Executor 
  */
@@ -44,6 +50,9 @@ public:
     using ErrorCode = ErrorCode_Ns::ErrorCode;
     using MutexType = typename Reactor::MutexType;
     using TimerUniqueLock = std::unique_lock<MutexType>;
+    using TimerShardId = ExecutorNS::TimerShardId;
+    using CatchUpPolicy = Types::CatchUpPolicy;
+    using TimerStatistics = Types::TimerStatistics;
     
     enum class TimerStatus{
         kPending,
@@ -63,18 +72,54 @@ public:
     struct TimerQueueEntry{
         Expiry expiry_{Types::kMaxExpiry}; /* max expiry to indicate invalid entry */
         Duration interval_{};
+        Duration slack_{}; /* how late the timer is allowed to fire so that it can share a wakeup with others */
         Handler handler_;
         bool is_valid_;
-        bool in_progress_{false};
+        std::uint32_t in_progress_{0u}; /* handler invocations dispatched to the executor that have not yet returned */
+        bool release_pending_{false}; /* removed while its handler was running */
+        CatchUpPolicy catch_up_{CatchUpPolicy::kSkip};
+        std::uint32_t catch_up_pending_{0u}; /* missed periods still to be run back-to-back (kBurst only) */
+        Expiry catch_up_deadline_{};         /* deadline of the oldest period still to be caught up on */
+        TimerStatistics stats_{};
     };
 
     struct QueuedTimerEntry{
-        Expiry expiry_;
+        Expiry expiry_;   /* earliest point in time the timer may fire */
+        Expiry deadline_; /* latest point in time the timer may fire, ie: expiry + slack */
         TimerTag tag_;
     };
 
-    TimerQueue(Executor& executor, TimerQSizeType size_hint = 25u) noexcept //todo
-        : executor_{executor}, reactor_{executor.UseReactorService()}, timers_(Types::kMaxTimerCount) /* default initialize timer storage */
+    /**
+     * @brief Counters describing how well timer expiries are being coalesced
+     * 
+     * @details Without coalescing every expiry costs one reactor wakeup. 
+     *  The difference between expiries and wakeups is therefore the number of wakeups saved.
+     */
+    struct Statistics{
+        std::uint64_t wakeups_{};           /* timerfd expirations handled */
+        std::uint64_t expiries_{};          /* timer expiries handled during those wakeups */
+        std::uint64_t rearms_{};            /* calls to timerfd_settime() */
+        std::uint64_t rearms_skipped_{};    /* calls to timerfd_settime() avoided since an armed wakeup already serves the timer */
+        std::uint64_t batches_{};           /* batches of expired handlers posted to the executor */
+        std::uint64_t overruns_{};          /* expiries of recurring timers dropped since the previous invocation was still pending */
+        Duration elapsed_{};                /* time since the timer queue is constructed */
+
+        constexpr std::uint64_t WakeupsSaved() const noexcept
+        {
+            return (this->expiries_ > this->wakeups_) ? (this->expiries_ - this->wakeups_) : 0u;
+        }
+
+        constexpr double WakeupsSavedPerSecond() const noexcept
+        {
+            const auto seconds{std::chrono::duration<double>{this->elapsed_}.count()};
+            return (seconds > 0.0) ? (static_cast<double>(this->WakeupsSaved()) / seconds) : 0.0;
+        }
+    };
+
+    TimerQueue(Executor& executor, TimerQSizeType size_hint = 25u, TimerShardId shard = 0u) noexcept //todo
+        : executor_{executor}, reactor_{executor.UseReactorService()}, 
+          timers_(Types::kMaxTimerCount), /* default initialize timer storage */
+          shard_{shard}
     {
         OsAbstraction::TimerFd_Create(CLOCK_MONOTONIC, TFD_CLOEXEC)
         .and_then([this, size_hint](asrt::NativeHandle timerfd){
@@ -117,7 +162,12 @@ public:
             .map([this, &handler](TimerTag tag){
                 auto& timer_to_reserve{this->timers_[ToTimerIndex(tag)]};
                 timer_to_reserve.handler_ = std::move(handler);
-                timer_to_reserve.in_progress_ = false; //todo necessary?
+                timer_to_reserve.in_progress_ = 0u; //todo necessary?
+                timer_to_reserve.release_pending_ = false;
+                timer_to_reserve.is_valid_ = true; /* so that a timer that was never armed can still be removed */
+                timer_to_reserve.catch_up_ = CatchUpPolicy::kSkip;
+                timer_to_reserve.catch_up_pending_ = 0u;
+                timer_to_reserve.stats_ = TimerStatistics{};
                 return tag;
             });
     }
@@ -129,11 +179,14 @@ public:
      * @param timer 
      * @param expiry 
      * @param interval 
+     * @param slack the timer may fire anywhere within [expiry, expiry + slack]. 
+     *  Timers whose windows overlap are expired with a single wakeup.
      */
-    auto Enqueue(TimerTag timer, Expiry expiry, Duration interval) noexcept -> Result<void>
+    auto Enqueue(TimerTag timer, Expiry expiry, Duration interval, Duration slack = Duration{}) noexcept -> Result<void>
     {
 
         TimerUniqueLock lock{this->GetMutexUnsafe()};
+        this->ProcessRemoteDequeues();
 
         if(expiry == Expiry{}) /* zero expiry timers */
         {   
@@ -142,34 +195,92 @@ public:
             (void)interval; 
 
             /* directly queue timer handler for executor invocation */
-            this->HandleOneExpiry(lock, timer);
+            this->timers_[ToTimerIndex(timer)].in_progress_++;
+            lock.unlock();
+            this->executor_.Post(this->MakeExpiryOperation(timer, Clock::now()));
 
             return Result<void>{};
         }
        
-        return this->DoAddTimer(timer, expiry, interval);
+        return this->DoAddTimer(timer, expiry, interval, slack);
     }
 
     /**
      * @brief Removes timer from timer queue. All pending timers will still be called.
+     * @details When called from a thread belonging to another shard the removal is 
+     *  handed over to this shard and carried out asynchronously, before its next expiry at the latest. 
+     *  This function then returns before the timer is removed. Expired handlers of the timer 
+     *  already dispatched to the executor may still run afterwards.
      * 
      * @param timer 
      */
     auto Dequeue(TimerTag timer) noexcept -> Result<void>
     {
+        if(not this->IsOwningThread()) [[unlikely]] {
+            return this->PostRemoteDequeue(timer);
+        }
+
         std::scoped_lock const lock(this->GetMutexUnsafe());
+        this->ProcessRemoteDequeues();
 
         return this->DoRemoveTimer(timer)
-                .map([this, timer](){
-                    this->RecycleTimerTag(timer);
+                .map([this, timer](bool recyclable){
+                    if(recyclable) this->RecycleTimerTag(timer);
                 });
     }
 
+    /**
+     * @brief Select what a recurring timer does about periods it could not be serviced in time for
+     * 
+     * @param timer 
+     * @param policy 
+     */
+    auto SetCatchUpPolicy(TimerTag timer, CatchUpPolicy policy) noexcept -> Result<void>
+    {
+        if(!this->IsTimerValid(timer)) [[unlikely]] {
+            return MakeUnexpected(ErrorCode::timer_not_exist);
+        }
+
+        std::scoped_lock const lock(this->GetMutexUnsafe());
+        this->timers_[ToTimerIndex(timer)].catch_up_ = policy;
+        return Result<void>{};
+    }
+
+    /**
+     * @brief Retrieve a snapshot of the schedule keeping counters of a timer
+     */
+    auto GetTimerStatistics(TimerTag timer) noexcept -> Result<TimerStatistics>
+    {
+        if(!this->IsTimerValid(timer)) [[unlikely]] {
+            return MakeUnexpected(ErrorCode::timer_not_exist);
+        }
+
+        std::scoped_lock const lock(this->GetMutexUnsafe());
+        return this->timers_[ToTimerIndex(timer)].stats_;
+    }
+
+    TimerShardId GetShardId() const noexcept
+    {
+        return this->shard_;
+    }
+
+    /**
+     * @brief Retrieve a snapshot of the coalescing statistics
+     */
+    auto GetStatistics() noexcept -> Statistics
+    {
+        std::scoped_lock const lock(this->GetMutexUnsafe());
+        Statistics stats{this->stats_};
+        stats.elapsed_ = Clock::now() - this->start_time_;
+        return stats;
+    }
+
 private:
 
     using TimerStorage = std::vector<TimerQueueEntry>;
     using QueuedTimers = std::vector<QueuedTimerEntry>;
     using RecycledTimers = std::queue<TimerTag>;
+    using RemoteRequests = std::vector<TimerTag>;
     using ReactorHandle = typename Reactor::HandlerTag;
 
     MutexType& GetMutexUnsafe() noexcept
@@ -185,18 +296,41 @@ private:
 
         ASRT_LOG_TRACE("[TimerQueue]: queue size {}", this->queued_timers_.size());
 
+        /* timerfd has fired and is no longer armed */
+        this->armed_deadline_ = Types::kMaxExpiry;
+        this->stats_.wakeups_++;
+
+        /* carry out cancellations forwarded by threads of other shards before anything expires */
+        this->ProcessRemoteDequeues();
+
+        /* expire every timer whose window has opened by now, not just the one we armed for.
+            a single snapshot is used so that rearmed recurring timers do not keep us looping. 
+            handlers are only collected here; they are run by the executor once the lock is released */
+        const Expiry now{Clock::now()};
+        thread_local ExecutorNS::OperationQueue expired_batch; /* reused so that collecting a batch does not allocate */
         auto timer{this->GetNextTimer()};
-        while((this->queued_timers_.size() > 0) && this->IsExpired(timer)){
-            ASRT_LOG_TRACE("[TimerQueue]: Timer {} expired? {}", timer, this->IsExpired(timer));
-            this->HandleOneExpiry(lock, timer); /* rearms or removes timer depending on timer type */
+        while((this->queued_timers_.size() > 0) && this->IsExpired(timer, now)){
+            ASRT_LOG_TRACE("[TimerQueue]: Timer {} expired", timer);
+            this->HandleOneExpiry(timer, now, expired_batch); /* rearms or removes timer depending on timer type */
+            this->stats_.expiries_++;
             timer = this->GetNextTimer();
         }
 
         /* prime timerfd for next expiry */
         if(!this->queued_timers_.empty()){
-            this->UpdateTimerFd(this->GetNextExpiry());
+            this->ArmTimerFd(this->GetNextDeadline());
             /* a new asynchronous operation is started each time the timerfd is rearmed */
             this->executor_.OnJobArrival();
+        }else{
+            this->DisarmTimerFd();
+        }
+
+        if(!expired_batch.empty()){
+            ASRT_LOG_TRACE("[TimerQueue]: Dispatching {} expired timer(s)", expired_batch.size());
+            this->stats_.batches_++;
+            lock.unlock(); /* handlers may well call back into the timer queue */
+            this->executor_.PostBatch(expired_batch);
+            lock.lock();
         }
     }
 
@@ -206,9 +340,10 @@ private:
      * @param timer 
      * @param expiry 
      * @param interval 
+     * @param slack 
      * @return Result<void> 
      */
-    Result<void> DoAddTimer(TimerTag timer, Expiry expiry, Duration interval) noexcept
+    Result<void> DoAddTimer(TimerTag timer, Expiry expiry, Duration interval, Duration slack) noexcept
     {
         Result<void> result{};
         ASRT_LOG_TRACE("[TimerQueue]: Adding timer {}", timer);
@@ -218,16 +353,22 @@ private:
             auto& timer_to_update{this->timers_[ToTimerIndex(timer)]};
             timer_to_update.expiry_ = expiry;
             timer_to_update.interval_ = interval;
+            timer_to_update.slack_ = slack;
             timer_to_update.is_valid_ = true;
         }
 
-        /* update timer fd if the timer to add is the next expiring timer */
-        if(this->IsNextExpiring(expiry)){
+        const Expiry deadline{ToDeadline(expiry, slack)};
+
+        /* only touch the timerfd if the currently armed wakeup would fire too late for this timer */
+        if(deadline < this->armed_deadline_){
             ASRT_LOG_TRACE("[TimerQueue]: (AddTimer) Updating timer fd for timer {}", timer);
-            result = this->UpdateTimerFd(expiry);
+            result = this->ArmTimerFd(deadline);
+        }else if(this->armed_deadline_ >= expiry){ /* armed wakeup falls within window of this timer */
+            ASRT_LOG_TRACE("[TimerQueue]: (AddTimer) Coalesced timer {} with armed wakeup", timer);
+            this->stats_.rearms_skipped_++;
         }
 
-        this->queued_timers_.emplace_back(QueuedTimerEntry{expiry, timer});
+        this->queued_timers_.emplace_back(QueuedTimerEntry{expiry, deadline, timer});
         this->OnQueueUpdate();
 
         return result;
@@ -245,11 +386,13 @@ private:
         auto& timer_to_update{this->timers_[ToTimerIndex(timer)]};
         timer_to_update.expiry_ = expiry;
         timer_to_update.interval_ = interval;
+        const Expiry deadline{ToDeadline(expiry, timer_to_update.slack_)};
 
         auto timer_it{std::find_if(this->queued_timers_.begin(), this->queued_timers_.end(),
-            [this, timer, expiry](auto& timer_in_queue){
+            [this, timer, expiry, deadline](auto& timer_in_queue){
                 if(timer_in_queue.tag_ == timer){
                     timer_in_queue.expiry_ = expiry;
+                    timer_in_queue.deadline_ = deadline;
                     this->OnQueueUpdate();
                     return true;
                 }else return false;
@@ -269,6 +412,50 @@ private:
         return this->queued_timers_.front().expiry_;
     }
 
+    /**
+     * @brief Retrieves the earliest deadline (expiry + slack) in queue. Assumes timer queue not empty.
+     * @details Arming the timerfd at this point (rather than at the next expiry) lets 
+     *  every timer whose window has opened in the meantime ride on the same wakeup.
+     */
+    Expiry GetNextDeadline() const noexcept
+    {
+        return std::min_element(this->queued_timers_.begin(), this->queued_timers_.end(),
+            [](const QueuedTimerEntry& timer1, const QueuedTimerEntry& timer2){
+                return timer1.deadline_ < timer2.deadline_;
+            })->deadline_;
+    }
+
+    static constexpr Expiry ToDeadline(Expiry expiry, Duration slack) noexcept
+    {
+        /* saturate instead of overflowing */
+        return (slack > (Types::kMaxExpiry - expiry)) ? Types::kMaxExpiry : (expiry + slack);
+    }
+
+    /**
+     * @brief Arms timerfd for the given deadline unless it is already armed for it
+     */
+    Result<void> ArmTimerFd(Expiry deadline) noexcept
+    {
+        if(deadline == this->armed_deadline_){
+            this->stats_.rearms_skipped_++;
+            return Result<void>{};
+        }
+
+        return this->UpdateTimerFd(deadline)
+            .map([this, deadline](){
+                this->armed_deadline_ = deadline;
+                this->stats_.rearms_++;
+            });
+    }
+
+    Result<void> DisarmTimerFd() noexcept
+    {
+        return this->UpdateTimerFd(Expiry{})
+            .map([this](){
+                this->armed_deadline_ = Types::kMaxExpiry;
+            });
+    }
+
     /**
      * @brief Rearms timerfd with new timeout
      * @details There are three scenarios that (may) warrant a call to UpdateTimerFd():
@@ -297,37 +484,59 @@ private:
      *        2. release handler memory if safe
      *        3. Update timer queue
      * @param timer 
-     * @return Result<void> 
+     * @return Result<bool> whether the tag may be recycled right away. 
+     *  If the handler is mid execution the tag is recycled once it returns.
      */
-    Result<void> DoRemoveTimer(TimerTag timer) noexcept
+    Result<bool> DoRemoveTimer(TimerTag timer) noexcept
     {
         /* assumes lock held */
 
         ASRT_LOG_TRACE("[TimerQueue]: Removing timer {}", timer);
 
+        bool recyclable{true};
+
         { /* release handler memory */
             auto& timer_to_remove{this->timers_[ToTimerIndex(timer)]};
 
             if(timer_to_remove.is_valid_){
-                if(!timer_to_remove.in_progress_){
+                if(timer_to_remove.in_progress_ == 0u){
                     Handler temp_handler = std::move(timer_to_remove.handler_);
                     /* do not recycle the tag just yet. 
                     leave that responsibility to Dequeue() */
                     ////this->RecycleTimerTag(timer_tag); 
                 }else{ /* do it later when timer is expired */
-                    this->release_handler_memory_ = true;
+                    timer_to_remove.release_pending_ = true;
+                    recyclable = false;
                 }
                 timer_to_remove.is_valid_ = false;
+                timer_to_remove.catch_up_pending_ = 0u;
             }else{ /* timer already de-registered */
-                return {}; //there's nothing to do we can exit now
+                return false; //there's nothing to do we can exit now
             }
         }
 
+        if(!this->IsQueued(timer)){ /* one-shot timer that has already expired or timer never armed */
+            return recyclable;
+        }
+
+        /* an armed wakeup that turns out to be early for the remaining timers is harmless
+            (nothing expires and the timerfd is simply rearmed) so we only disarm once the queue drains */
         return this->RemoveTimerFromQueue(timer)
-            .and_then([this, timer]() -> Result<void> {
-                return this->IsNextExpiring(timer) ?
-                    this->UpdateTimerFd(Expiry{}) : /* disarm timer */
+            .and_then([this]() -> Result<void> {
+                return this->queued_timers_.empty() ?
+                    this->DisarmTimerFd() :
                     Result<void>{};
+            })
+            .map([recyclable](){
+                return recyclable;
+            });
+    }
+
+    bool IsQueued(TimerTag timer) const noexcept
+    {
+        return std::ranges::any_of(this->queued_timers_, 
+            [timer](const auto& entry){
+                return entry.tag_ == timer;
             });
     }
 
@@ -373,43 +582,183 @@ private:
         return tag;
     }
 
-    void HandleOneExpiry(TimerUniqueLock& lock, TimerTag tag) noexcept
+    /**
+     * @brief Rearm or remove an expired timer and add its handler to the batch to be dispatched
+     * @details A recurring timer whose previous invocation is still pending is not dispatched again, 
+     *  ie: the handler of a recurring timer never runs concurrently with itself. 
+     *  The period is then accounted as missed and handled according to the catch-up policy of the timer.
+     */
+    void HandleOneExpiry(TimerTag tag, Expiry now, ExecutorNS::OperationQueue& batch) noexcept
     {
-        /* assumes lock held */ /* Lock is held at function entry */
+        /* assumes lock held */
 
         auto& expired_timer{this->timers_[ToTimerIndex(tag)]};
-        expired_timer.in_progress_ = true; /* this ensures the timer and its handler stays valid after the mutex is unlocked */
-        ASRT_LOG_TRACE("[TimerQueue]: Calling Timer {} OnTimerExpiry()", tag);
+        const bool recurring{expired_timer.interval_.count() != 0};
+
+        if(!recurring || (expired_timer.in_progress_ == 0u)) [[likely]] {
+            ASRT_LOG_TRACE("[TimerQueue]: Queueing Timer {} OnTimerExpiry()", tag);
+            expired_timer.in_progress_++; /* this ensures the timer and its handler stays valid until the handler returns */
+            batch.push_back(this->MakeExpiryOperation(tag, expired_timer.expiry_));
+        }else{
+            ASRT_LOG_TRACE("[TimerQueue]: Timer {} still running, period missed", tag);
+            this->stats_.overruns_++;
+            this->OnMissedPeriods(expired_timer, expired_timer.expiry_, 1u);
+        }
+
+        if(!recurring){ /* one-shot timer */
+            ASRT_LOG_TRACE("Removing expired timer {} from queue", tag);
+            this->RemoveTimerFromQueue(tag);
+        }else{ /* recurring timer */
+            ASRT_LOG_TRACE("Rearming timer {}", tag);
+            this->UpdateTimerExpiry(tag, this->GetNextPeriod(expired_timer, now), expired_timer.interval_);
+        }
+    }
+
+    /**
+     * @brief Work out the next deadline of a recurring timer
+     * @details Deadlines are derived from the previous deadline rather than from the time 
+     *  the timer got serviced so that the period does not drift. The result always lies ahead of now.
+     */
+    Expiry GetNextPeriod(TimerQueueEntry& timer, Expiry now) noexcept
+    {
+        const Expiry next_expiry{timer.expiry_ + timer.interval_};
+        if(next_expiry > now) [[likely]] {
+            return next_expiry;
+        }
 
-        lock.unlock(); /* unlock to avoid deadlock when calling handler */
+        /* serviced too late: one or more whole periods have elapsed in the meantime */
+        const auto missed{static_cast<std::uint64_t>((now - timer.expiry_) / timer.interval_)};
+        this->OnMissedPeriods(timer, next_expiry, missed);
 
-        auto prev_expiry{Clock::now()}; /* take an early timestamp to account for time spent invoking the handler */ //todo
+        if(timer.catch_up_ == CatchUpPolicy::kDelay){
+            return now + timer.interval_;
+        }else{ /* stay on the original schedule */
+            return timer.expiry_ + (missed + 1u) * timer.interval_;
+        }
+    }
+
+    void OnMissedPeriods(TimerQueueEntry& timer, Expiry first_missed, std::uint64_t missed) noexcept
+    {
+        timer.stats_.missed_deadlines_ += missed;
+
+        if(timer.catch_up_ == CatchUpPolicy::kBurst){
+            if(timer.catch_up_pending_ == 0u){
+                timer.catch_up_deadline_ = first_missed;
+            }
+            timer.catch_up_pending_ += static_cast<std::uint32_t>(missed);
+        }
+    }
+
+    ExecutorNS::ExecutorOperation MakeExpiryOperation(TimerTag tag, Expiry deadline) noexcept
+    {
+        return [this, tag, deadline](){
+            this->InvokeExpiryHandler(tag, deadline);
+        };
+    }
+
+    /**
+     * @brief Runs on the executor. Calls the handler of an expired timer without holding the timer queue lock
+     * @details Periods a kBurst timer has fallen behind on are run back-to-back from here, one at a time.
+     * 
+     * @param tag 
+     * @param deadline the deadline this invocation serves, used to account for lateness
+     */
+    void InvokeExpiryHandler(TimerTag tag, Expiry deadline) noexcept
+    {
+        auto& expired_timer{this->timers_[ToTimerIndex(tag)]};
+        ASRT_LOG_TRACE("[TimerQueue]: Calling Timer {} OnTimerExpiry()", tag);
+
+        const Duration lateness{std::max(Duration{Clock::now() - deadline}, Duration{})};
         expired_timer.handler_(tag); /* call Timer.OnTimerExpiry() */
 
-        lock.lock();
-        expired_timer.in_progress_ = false;
+        TimerUniqueLock lock{this->GetMutexUnsafe()};
+        expired_timer.in_progress_--;
+
+        { /* account for schedule keeping */
+            auto& stats{expired_timer.stats_};
+            stats.invocations_++;
+            stats.max_lateness_ = std::max(stats.max_lateness_, lateness);
+            stats.lateness_.Record(lateness);
+        }
 
-        if(this->release_handler_memory_){ /* this is our cue (no pun intended ;P) to release handler memory */
+        if(expired_timer.release_pending_ && (expired_timer.in_progress_ == 0u)){ /* this is our cue (no pun intended ;P) to release handler memory */
             /* arriving here means the timer has already been removed from queued_timers
                 also timerfd has already been disarmed so the only thing left to do 
                 is to release memory and recycle tag */
             Handler placeholder;
             ASRT_LOG_TRACE("Releasing timer handler memory for timer {}", tag);
             placeholder = std::move(expired_timer.handler_);
-            this->release_handler_memory_ = false;
-            return; 
+            expired_timer.release_pending_ = false;
+            this->RecycleTimerTag(tag);
+            return;
         }
 
-        if(expired_timer.interval_.count() == 0){ /* one-shot timer */
-            ASRT_LOG_TRACE("Removing expired timer {} from queue", tag);
-            this->RemoveTimerFromQueue(tag);
-        }else{ /* recurring timer */
-            ASRT_LOG_TRACE("Rearming timer {}", tag);
-            auto new_expiry{prev_expiry + expired_timer.interval_};
-            this->UpdateTimerExpiry(tag, new_expiry, expired_timer.interval_);
+        if((expired_timer.catch_up_pending_ != 0u) && expired_timer.is_valid_ && (expired_timer.in_progress_ == 0u)){
+            ASRT_LOG_TRACE("[TimerQueue]: Timer {} catching up, {} period(s) behind", tag, expired_timer.catch_up_pending_);
+            expired_timer.catch_up_pending_--;
+            expired_timer.in_progress_++;
+            const Expiry catch_up_deadline{expired_timer.catch_up_deadline_};
+            expired_timer.catch_up_deadline_ += expired_timer.interval_;
+            lock.unlock();
+            this->executor_.Post(this->MakeExpiryOperation(tag, catch_up_deadline));
         }
     }
 
+    bool IsOwningThread() const noexcept
+    {
+        return this->executor_.CurrentTimerShard() == this->shard_;
+    }
+
+    /**
+     * @brief Hand a cancellation over to this shard
+     * @details Only the small request list is locked here. Unless a hand-over is already on its way, 
+     *  an operation is then posted to the executor that carries out the requests under the shard lock. 
+     *  It is an ordinary executor job, counted on Post() and completed once it has run.
+     */
+    Result<void> PostRemoteDequeue(TimerTag timer) noexcept
+    {
+        ASRT_LOG_TRACE("[TimerQueue]: Forwarding removal of timer {} to shard {}", timer, this->shard_);
+        {
+            std::scoped_lock const lock{this->remote_requests_mtx_};
+            this->remote_dequeues_.push_back(timer);
+        }
+
+        if(this->handover_pending_.exchange(true, std::memory_order_acq_rel)){
+            return Result<void>{}; /* picked up along with the pending ones */
+        }
+
+        this->executor_.Post([this](){
+            std::scoped_lock const lock{this->GetMutexUnsafe()};
+            this->ProcessRemoteDequeues();
+        });
+        return Result<void>{};
+    }
+
+    /**
+     * @brief Carry out the cancellations forwarded by threads of other shards
+     * @details Called by the posted hand-over as well as by every other locked operation of this shard, 
+     *  whichever comes first. A hand-over that finds the requests already carried out has nothing left to do.
+     */
+    void ProcessRemoteDequeues() noexcept
+    {
+        /* assumes lock held */
+        if(not this->handover_pending_.load(std::memory_order_acquire)) [[likely]] return;
+        this->handover_pending_.store(false, std::memory_order_release);
+
+        RemoteRequests requests;
+        {
+            std::scoped_lock const lock{this->remote_requests_mtx_};
+            requests.swap(this->remote_dequeues_);
+        }
+
+        std::ranges::for_each(requests, [this](TimerTag timer){
+            (void)this->DoRemoveTimer(timer)
+                .map([this, timer](bool recyclable){
+                    if(recyclable) this->RecycleTimerTag(timer);
+                });
+        });
+    }
+
     Result<void> RegisterExpiryHandlerWithReactor() noexcept
     {
         return this->reactor_.RegisterTimerHandler(this->timer_fd_,
@@ -442,10 +791,9 @@ private:
         return this->timers_.begin() + ToTimerIndex(tag);
     }
 
-    bool IsExpired(TimerTag timer) const noexcept //todo timer validity check
+    bool IsExpired(TimerTag timer, Expiry now) const noexcept //todo timer validity check
     {
-        auto expiry{this->timers_[ToTimerIndex(timer)].expiry_};
-        return IsTimerValid(timer) ? (expiry <= Clock::now()) : false;
+        return IsTimerValid(timer) ? (this->timers_[ToTimerIndex(timer)].expiry_ <= now) : false;
     }
 
     bool IsTimerValid(TimerTag timer) const noexcept
@@ -453,39 +801,11 @@ private:
         return timer != Timer::Types::kInvalidTimerTag;
     }
 
-    /**
-     * @brief Checks whether the expiry to check is sooner than that of the earliest expiry in queue
-     * 
-     * @pre Assumes the queue is heapified and that the expiry has not yet been enqueued 
-     */
-    bool IsNextExpiring(Expiry expiry) const noexcept
-    {
-        /* do not report true if the expiry evaluates to be the same 
-            as that of the next expiry to avoid a unnecessary subsequent syscall */
-        return this->queued_timers_.empty() ?
-            true : (expiry < this->GetNextExpiry()); 
-        //! assumes that the timerfd never notifies us earlier than we asked for (later is ok)
-    }
-
     auto GetTimerExpiry(TimerTag tag) const noexcept
     {
         return this->timers_[tag].expiry_;
     }
 
-    /**
-     * @brief Checks whether the timer is the next one to expire
-     * 
-     * @pre Assumes the queue is non-empty and heapified and that the timer is already in queue
-     * @return false if not next expiring
-     */
-    bool IsNextExpiring(TimerTag tag) const noexcept
-    {
-        /* do not report true if the expiry evaluates to be the same 
-            as that of the next expiry to avoid a unnecessary subsequent syscall */
-        return tag == this->queued_timers_.front().tag_; 
-        //! assumes that the timerfd never notifies us earlier than we asked for (later is ok)
-    }
-
     /**
      * @brief Needs to be called whenvever queued_timers_ is updated
      * @details Heapifies the timer queue so that the timer with least expiry bubbles up
@@ -525,13 +845,25 @@ private:
     QueuedTimers queued_timers_;
 
     MutexType* timerq_mutex_;
+
+    /**
+     * @brief the deadline the timerfd is currently armed for. kMaxExpiry when disarmed
+     */
+    Expiry armed_deadline_{Types::kMaxExpiry};
+
+    Statistics stats_{};
+    const Expiry start_time_{Clock::now()};
+
+    const TimerShardId shard_;
+
+    MutexType remote_requests_mtx_;
+    RemoteRequests remote_dequeues_; /* removals posted by threads of other shards */
+    std::atomic<bool> handover_pending_{false}; /* an operation carrying out the posted removals is on its way */
     
     /**
      * @brief points to the last used timer in timer storage
      */
     TimerIndex tag_end_{};
-
-    bool release_handler_memory_{false};
 };
 
 
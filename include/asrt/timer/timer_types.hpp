@@ -2,8 +2,12 @@
 #define CB153FD7_0121_4FDC_97FD_DAA6990F7BA6
 #include <cstdint>
 #include <mutex>
+#include <array>
+#include <bit>
+#include <algorithm>
 
 #include "asrt/config.hpp"
+#include "asrt/inplace_function.hpp"
 #include "asrt/timer/timer_util.hpp"
 
 namespace Timer::Types{
@@ -15,12 +19,54 @@ namespace Timer::Types{
     using Timer::util::SteadyClock;
     using Expiry = Timer::util::TimePointInNsec<SteadyClock>;
     using Duration = Nanoseconds;
-    using EventHandler = std::function<void(TimerTag)>;
+    using EventHandler = asrt::InplaceFunction<void(TimerTag), asrt::config::kTimerHandlerCapacity>;
 
     static constexpr TimerTagUnderlying kMaxTimerCount{asrt::config::kMaxTimerQueueSize - 1};
     static constexpr TimerTag kInvalidTimerTag{std::numeric_limits<TimerTagUnderlying>::max()};
     static constexpr Expiry kMaxExpiry{Nanoseconds{std::numeric_limits<Nanoseconds::rep>::max()}};
 
+    /**
+     * @brief What a recurring timer does about periods that have already elapsed by the time it gets serviced
+     * @details Deadlines of recurring timers are absolute (expiry + n * interval) so that periods do not drift.
+     *  kSkip:  drop the missed periods and carry on at the next deadline still ahead
+     *  kBurst: run the missed periods back-to-back, then carry on at the next deadline still ahead
+     *  kDelay: drop the missed periods and restart the schedule one interval from now
+     */
+    enum class CatchUpPolicy : std::uint8_t { kSkip, kBurst, kDelay };
+
+    /**
+     * @brief Counts how late handler invocations start, in power-of-two microsecond buckets
+     * @details Bucket 0 holds lateness below 1us, bucket n (n > 0) holds [2^(n-1), 2^n) us. 
+     *  The last bucket also collects everything beyond.
+     */
+    struct LatenessHistogram{
+        static constexpr std::size_t kBucketCount{20u}; /* last regular bucket ends at ~262ms */
+
+        std::array<std::uint64_t, kBucketCount> buckets_{};
+
+        static constexpr std::size_t ToBucket(Duration lateness) noexcept
+        {
+            const auto usec{std::chrono::duration_cast<std::chrono::microseconds>(lateness).count()};
+            if(usec <= 0) return 0u;
+            return std::min<std::size_t>(std::bit_width(static_cast<std::uint64_t>(usec)), kBucketCount - 1);
+        }
+
+        constexpr void Record(Duration lateness) noexcept
+        {
+            this->buckets_[ToBucket(lateness)]++;
+        }
+    };
+
+    /**
+     * @brief Per-timer counters describing how closely a timer keeps to its schedule
+     */
+    struct TimerStatistics{
+        std::uint64_t invocations_{};       /* handler invocations started */
+        std::uint64_t missed_deadlines_{};  /* periods that had fully elapsed before they could be serviced */
+        Duration max_lateness_{};           /* worst delay between a deadline and the start of its invocation */
+        LatenessHistogram lateness_{};
+    };
+
 }
 
 #endif /* CB153FD7_0121_4FDC_97FD_DAA6990F7BA6 */
@@ -2,6 +2,7 @@
 #define B8E8ABDD_A3ED_430E_ADDB_0F3234415CCB
 
 #include <sys/un.h>
+#include <cstddef>
 #include <type_traits>
 #include <linux/if_ether.h>
 
@@ -41,6 +42,8 @@ namespace Buffer
 {
     class MutableBufferView;
     class ConstBufferView;
+    template <typename BufferView, std::size_t MaxBuffers>
+    class BasicBufferSequence;
 }
 
 namespace SocketTraits
@@ -211,6 +214,18 @@ namespace BufferViewTraits{
     template <>
     struct is_mutable<Buffer::MutableBufferView> : std::true_type {};
 
+    template <typename BufferSequence>
+    struct is_sequence : std::false_type {};
+
+    template <typename BufferView, std::size_t N>
+    struct is_sequence<Buffer::BasicBufferSequence<BufferView, N>> : std::true_type {};
+
+    template <typename BufferView, std::size_t N>
+    struct is_valid<Buffer::BasicBufferSequence<BufferView, N>> : is_valid<BufferView> {};
+
+    template <typename BufferView, std::size_t N>
+    struct is_mutable<Buffer::BasicBufferSequence<BufferView, N>> : is_mutable<BufferView> {};
+
 }
 
 
@@ -0,0 +1,147 @@
+/**
+ * @brief Batched accept loop under a connection storm and the SO_REUSEPORT acceptor group
+ */
+#include <atomic>
+#include <csignal>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "asrt/ip/tcp.hpp"
+#include "test_util.hpp"
+
+namespace{
+
+    namespace tcp = asrt::ip::tcp;
+
+    constexpr int kConnections{300};
+
+    /* connect kConnections clients to the loopback port, kept open until the storm is destroyed */
+    class ConnectionStorm
+    {
+    public:
+        explicit ConnectionStorm(std::uint16_t port)
+            : thread_{[this, port](){
+                for(int i{0}; i < kConnections; ++i){
+                    int const fd{::socket(AF_INET, SOCK_STREAM, 0)};
+                    ::sockaddr_in address{};
+                    address.sin_family = AF_INET;
+                    address.sin_port = htons(port);
+                    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                    if(::connect(fd, reinterpret_cast<::sockaddr const*>(&address), sizeof(address)) != 0) ++this->failures_;
+                    this->fds_.push_back(fd);
+                }
+            }} {}
+
+        ~ConnectionStorm()
+        {
+            this->Join();
+            for(int const fd : this->fds_) ::close(fd);
+        }
+
+        int Failures() { this->Join(); return this->failures_; }
+
+    private:
+        void Join() { if(this->thread_.joinable()) this->thread_.join(); }
+
+        std::vector<int> fds_;
+        int failures_{0};
+        std::thread thread_;
+    };
+
+    std::uint16_t PortOf(tcp::endpoint const& endpoint) { return ntohs(endpoint.Port()); }
+
+    void TestAcceptLoop()
+    {
+        tcp::executor executor;
+        tcp::acceptor acceptor{executor, tcp::endpoint{IP::AddressV4{"127.0.0.1"}, 0}};
+        acceptor.SetListenBacklog(1024);
+
+        int accepted{0};
+        int errors{0};
+        int other_jobs{0};
+        /* a small budget hands the executor back between batches */
+        auto const started{acceptor.AcceptLoopAsync([&](asrt::Result<int>&& result){
+            if(not result.has_value()){
+                ++errors;
+                return;
+            }
+            ::close(result.value());
+            if(++accepted == kConnections){
+                acceptor.StopAcceptLoop();
+                executor.Stop();
+            }
+        }, 8u)};
+        ASRT_TEST_CHECK(started.has_value());
+        ASRT_TEST_CHECK(not acceptor.AcceptLoopAsync([](asrt::Result<int>&&){}).has_value()); /* already running */
+
+        ConnectionStorm storm{PortOf(acceptor.GetLocalEndpoint())};
+        std::function<void()> tick{[&](){ ++other_jobs; executor.Post(std::function{tick}); }};
+        executor.Post(std::function{tick});
+        static_cast<void>(executor.Run());
+
+        ASRT_TEST_CHECK(storm.Failures() == 0);
+        ASRT_TEST_CHECK(accepted == kConnections);
+        ASRT_TEST_CHECK(errors == 0);
+        ASRT_TEST_CHECK(other_jobs > 0); /* the loop did not monopolize the executor */
+
+        /* a stopped loop may be started again */
+        ASRT_TEST_CHECK(acceptor.AcceptLoopAsync([](asrt::Result<int>&& result){
+            if(result.has_value()) ::close(result.value());
+        }).has_value());
+        acceptor.StopAcceptLoop();
+    }
+
+    void TestAcceptorGroup()
+    {
+        tcp::executor executor0;
+        tcp::executor executor1;
+        tcp::acceptor_group group{tcp::endpoint{IP::AddressV4{"127.0.0.1"}, 0}};
+        group.AddShard(executor0);
+        group.AddShard(executor1);
+        ASRT_TEST_CHECK(group.Size() == 2u);
+        ASRT_TEST_CHECK(group.Listen(1024).has_value());
+        ASRT_TEST_CHECK(PortOf(group.GetEndpoint()) != 0u); /* the ephemeral port the first shard bound */
+
+        std::atomic<int> accepted[2]{0, 0};
+        auto const handler{[&](int shard){
+            return [&, shard](asrt::Result<int>&& result){
+                if(not result.has_value()) return;
+                ::close(result.value());
+                ++accepted[shard];
+                if(accepted[0] + accepted[1] == kConnections){
+                    executor0.Stop();
+                    executor1.Stop();
+                }
+            };
+        }};
+        ASRT_TEST_CHECK(group.Shard(0u).AcceptLoopAsync(handler(0)).has_value());
+        ASRT_TEST_CHECK(group.Shard(1u).AcceptLoopAsync(handler(1)).has_value());
+
+        std::thread runner{[&executor1](){ static_cast<void>(executor1.Run()); }};
+        ConnectionStorm storm{PortOf(group.GetEndpoint())};
+        static_cast<void>(executor0.Run());
+        runner.join();
+
+        ASRT_TEST_CHECK(storm.Failures() == 0);
+        ASRT_TEST_CHECK(accepted[0] + accepted[1] == kConnections);
+        /* the kernel spreads connections over the listeners by hash */
+        ASRT_TEST_CHECK(accepted[0] > 0 && accepted[1] > 0);
+
+        group.Shard(0u).StopAcceptLoop();
+        group.Shard(1u).StopAcceptLoop();
+    }
+}
+
+int main()
+{
+    std::signal(SIGPIPE, SIG_IGN);
+    TestAcceptLoop();
+    TestAcceptorGroup();
+
+    return asrt::test::Result();
+}
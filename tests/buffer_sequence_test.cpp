@@ -0,0 +1,103 @@
+/**
+ * @brief Scatter/gather buffer sequences: construction, Advance() across views and vectored i/o
+ */
+#include <array>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "asrt/netbuffer.hpp"
+#include "asrt/sys/syscall.hpp"
+#include "test_util.hpp"
+
+namespace{
+
+    using Buffer::ConstBufferView;
+    using Buffer::MutableBufferView;
+    using SmallSequence = Buffer::BasicBufferSequence<ConstBufferView, 2u>;
+
+    /* more views than a sequence holds do not compile */
+    static_assert(std::is_constructible_v<SmallSequence, ConstBufferView, ConstBufferView>);
+    static_assert(!std::is_constructible_v<SmallSequence, ConstBufferView, ConstBufferView, ConstBufferView>);
+
+    void TestConstruction()
+    {
+        const std::string first{"hello "};
+        const std::string empty{};
+        const std::string second{"world"};
+
+        Buffer::ConstBufferSequence const seq{
+            Buffer::make_buffer(first), Buffer::make_buffer(empty), Buffer::make_buffer(second)};
+        ASRT_TEST_CHECK(seq.Count() == 2u); /* empty views are dropped */
+        ASRT_TEST_CHECK(seq.size() == first.size() + second.size());
+        ASRT_TEST_CHECK(seq[1].data() == second.data());
+
+        SmallSequence small{};
+        ASRT_TEST_CHECK(small.Empty());
+        ASRT_TEST_CHECK(small.Push(Buffer::make_buffer(first)));
+        ASRT_TEST_CHECK(small.Push(Buffer::make_buffer(second)));
+        ASRT_TEST_CHECK(!small.Push(Buffer::make_buffer(first))); /* full */
+        ASRT_TEST_CHECK(small.size() == first.size() + second.size());
+
+        std::array<char, 4> storage{};
+        Buffer::MutableBufferSequence const mutable_seq{Buffer::make_buffer(storage)};
+        Buffer::ConstBufferSequence const const_seq{mutable_seq};
+        ASRT_TEST_CHECK(const_seq.Count() == 1u);
+        ASRT_TEST_CHECK(const_seq.Front().data() == storage.data());
+    }
+
+    void TestAdvance()
+    {
+        const std::string first{"abc"};
+        const std::string second{"defgh"};
+        Buffer::ConstBufferSequence seq{Buffer::make_buffer(first), Buffer::make_buffer(second)};
+
+        seq.Advance(2u);
+        ASRT_TEST_CHECK(seq.Count() == 2u);
+        ASRT_TEST_CHECK(seq.size() == 6u);
+        ASRT_TEST_CHECK(seq.Front().data() == first.data() + 2);
+
+        seq += 3u; /* crosses into the second view */
+        ASRT_TEST_CHECK(seq.Count() == 1u);
+        ASRT_TEST_CHECK(seq.size() == 3u);
+        ASRT_TEST_CHECK(seq.Front().data() == second.data() + 2);
+
+        seq.Advance(100u); /* clamped to what is left */
+        ASRT_TEST_CHECK(seq.Empty());
+        ASRT_TEST_CHECK(seq.Count() == 0u);
+    }
+
+    void TestVectoredRoundTrip()
+    {
+        int fds[2];
+        ASRT_TEST_CHECK(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+        const std::string header{"HEAD"};
+        const std::string body{"body of the message"};
+        ASRT_TEST_CHECK(OsAbstraction::SendAllVectored(fds[0],
+            Buffer::make_buffer_sequence(Buffer::make_buffer(header), Buffer::make_buffer(body))).has_value());
+
+        std::array<char, 4> received_header{};
+        std::array<char, 32> received_body{};
+        auto const received{OsAbstraction::ReceiveVectored(fds[1],
+            Buffer::make_buffer_sequence(Buffer::make_buffer(received_header), Buffer::make_buffer(received_body)))};
+
+        ASRT_TEST_CHECK(received.has_value() && (received.value() == header.size() + body.size()));
+        ASRT_TEST_CHECK(std::memcmp(received_header.data(), header.data(), header.size()) == 0);
+        ASRT_TEST_CHECK(std::memcmp(received_body.data(), body.data(), body.size()) == 0);
+
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+}
+
+int main()
+{
+    TestConstruction();
+    TestAdvance();
+    TestVectoredRoundTrip();
+
+    return asrt::test::Result();
+}
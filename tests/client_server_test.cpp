@@ -0,0 +1,148 @@
+/**
+ * @brief ServerInterface and ClientInterface over a unix stream socket: validation, 
+ *  server messages coalesced by the connection writer and an rpc round trip
+ */
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "asrt/unix/unix_domain.hpp"
+#include "asrt/executor/executor_work_guard.hpp"
+#include "asrt/client_server/server_interface.hpp"
+#include "asrt/client_server/client_interface.hpp"
+#include "test_util.hpp"
+
+namespace{
+
+    using namespace std::chrono_literals;
+
+    constexpr std::uint32_t kMessages{1000u};
+    constexpr std::uint32_t kEchoMethod{1u};
+    constexpr std::uint8_t kCounterType{1u};
+    constexpr std::size_t kCounterLength{ClientServer::FrameHeader::kLength + sizeof(std::uint32_t)};
+
+    struct TestMessage
+    {
+        static constexpr std::size_t HeaderLength() { return 5u; }
+        Buffer::MutableBufferView HeaderView() { return {this->data_.data(), HeaderLength()}; }
+        Buffer::MutableBufferView BodyView() { return {this->data_.data() + HeaderLength(), this->data_.size() - HeaderLength()}; }
+        Buffer::ConstBufferView DataView() const { return {this->data_.data(), this->data_.size()}; }
+
+        std::vector<std::uint8_t> data_;
+    };
+
+    using Endpoint = Unix::Endpoint<ProtocolNS::UnixStream>;
+    using ServerBase = ClientServer::ServerInterface<Unix::Executor, ProtocolNS::UnixStream, TestMessage>;
+    using ClientBase = ClientServer::ClientInterface<Unix::Executor, ProtocolNS::UnixStream, TestMessage>;
+
+    class TestServer : public ServerBase
+    {
+    public:
+        using ServerBase::ServerBase;
+
+        void OnClientValidated(Client& client) noexcept override
+        {
+            /* issued within one executor turn, the writer merges them into few sends */
+            auto const header{ClientServer::FrameHeader{kCounterType, sizeof(std::uint32_t)}.Encode()};
+            std::array<std::uint8_t, kCounterLength> message;
+            std::memcpy(message.data(), header.data(), header.size());
+            for(std::uint32_t i{0u}; i < kMessages; ++i){
+                std::memcpy(message.data() + header.size(), &i, sizeof(i));
+                this->MessageClient(client, message);
+            }
+            ++this->validated_;
+        }
+
+        void OnRequest(Client client, ClientServer::RpcRequest request) noexcept override
+        {
+            if(request.Method() != kEchoMethod) return ServerBase::OnRequest(std::move(client), std::move(request));
+            static_cast<void>(this->Respond(client, request, request.Payload()));
+        }
+
+        std::atomic<int> validated_{0};
+    };
+
+    class TestClient : public ClientBase
+    {
+    public:
+        using ClientBase::ClientBase;
+
+        void OnMessage(ConstMessageView message) noexcept override
+        {
+            /* header followed by body, messages of a connection arrive in the order sent */
+            std::uint32_t value{};
+            if(message.size() == kCounterLength && message[0] == kCounterType)
+                std::memcpy(&value, message.data() + ClientServer::FrameHeader::kLength, sizeof(value));
+            else
+                this->in_order_ = false;
+            if(value != this->received_.load()) this->in_order_ = false;
+            ++this->received_;
+        }
+
+        std::atomic<std::uint32_t> received_{0u};
+        std::atomic<bool> in_order_{true};
+    };
+
+    template <typename Predicate>
+    bool WaitFor(Predicate predicate)
+    {
+        auto const deadline{std::chrono::steady_clock::now() + 10s};
+        while(not predicate()){
+            if(std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    std::signal(SIGPIPE, SIG_IGN);
+    std::string const path{"/tmp/asrt_client_server_test." + std::to_string(::getpid()) + ".sock"};
+    ::unlink(path.c_str());
+
+    TestServer server{Endpoint{path}};
+    std::thread server_thread{[&server](){ server.Run(); }};
+
+    Unix::Executor executor;
+    std::thread client_thread;
+    {
+        TestClient client{executor};
+        ExecutorNS::WorkGuard const guard{executor};
+        client_thread = std::thread{[&executor](){ static_cast<void>(executor.Run()); }};
+
+        client.Connect(Endpoint{path});
+        ASRT_TEST_CHECK(WaitFor([&](){ return client.IsConnected() && server.validated_ == 1; }));
+        ASRT_TEST_CHECK(WaitFor([&](){ return client.received_ == kMessages; }));
+        ASRT_TEST_CHECK(client.in_order_);
+
+        std::uint32_t const token{0xC0FFEEu};
+        std::atomic<int> echoed{0};
+        auto const call{client.Call(kEchoMethod, {reinterpret_cast<std::uint8_t const*>(&token), sizeof(token)}, 
+            [&echoed, token](asrt::Result<ClientServer::RpcReply> reply){
+                bool const ok{reply.has_value() && reply->Payload().size() == sizeof(token) && 
+                    std::memcmp(reply->Payload().data(), &token, sizeof(token)) == 0};
+                echoed = ok ? 1 : -1;
+            })};
+        ASRT_TEST_CHECK(call.has_value());
+        ASRT_TEST_CHECK(WaitFor([&](){ return echoed != 0; }));
+        ASRT_TEST_CHECK(echoed == 1);
+
+        client.Disconnect();
+        executor.Stop();
+        client_thread.join();
+    }
+
+    server.Stop();
+    server_thread.join();
+    ::unlink(path.c_str());
+
+    return asrt::test::Result();
+}
@@ -0,0 +1,103 @@
+/**
+ * @brief DynamicBuffer Prepare()/Commit()/Consume() and FindDelimiter()
+ */
+#include <cstring>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "asrt/netbuffer.hpp"
+#include "test_util.hpp"
+
+namespace{
+
+    void Append(Buffer::DynamicBuffer& buffer, std::string_view bytes)
+    {
+        Buffer::MutableBufferView const space{buffer.Prepare(bytes.size())};
+        ASRT_TEST_CHECK(space.size() >= bytes.size());
+        std::memcpy(space.data(), bytes.data(), bytes.size());
+        buffer.Commit(bytes.size());
+    }
+
+    std::string_view Readable(Buffer::DynamicBuffer const& buffer)
+    {
+        return {reinterpret_cast<char const*>(buffer.data()), buffer.size()};
+    }
+
+    void TestPrepareCommitConsume()
+    {
+        Buffer::DynamicBuffer buffer{};
+        ASRT_TEST_CHECK(buffer.Empty());
+
+        Append(buffer, "hello");
+        ASRT_TEST_CHECK(Readable(buffer) == "hello");
+
+        Append(buffer, " world"); /* grows and keeps the readable bytes */
+        ASRT_TEST_CHECK(Readable(buffer) == "hello world");
+
+        buffer.Consume(6u);
+        ASRT_TEST_CHECK(Readable(buffer) == "world");
+
+        buffer.Consume(100u); /* clamped, an empty buffer starts over at the front */
+        ASRT_TEST_CHECK(buffer.Empty());
+        ASRT_TEST_CHECK(buffer.Prepare(1u).data() == buffer.data());
+    }
+
+    void TestCompaction()
+    {
+        Buffer::DynamicBuffer buffer{Buffer::kDynamicExtent, 16u};
+        Append(buffer, "0123456789abcdef");
+        buffer.Consume(12u);
+
+        /* 4 readable bytes behind 12 consumed ones are moved to the front instead of growing */
+        Buffer::MutableBufferView const space{buffer.Prepare(8u)};
+        ASRT_TEST_CHECK(buffer.Capacity() == 16u);
+        ASRT_TEST_CHECK(Readable(buffer) == "cdef");
+        ASRT_TEST_CHECK(space.size() == 12u);
+    }
+
+    void TestMaxSize()
+    {
+        Buffer::DynamicBuffer buffer{8u};
+        Append(buffer, "123456");
+        ASRT_TEST_CHECK(buffer.Prepare(3u).size() == 0u); /* would exceed max size */
+        ASRT_TEST_CHECK(buffer.Prepare(2u).size() == 2u);
+
+        buffer.Commit(100u); /* clamped to the prepared region */
+        ASRT_TEST_CHECK(buffer.size() == 8u);
+    }
+
+    void TestFindDelimiter()
+    {
+        ASRT_TEST_CHECK(Buffer::FindDelimiter(Buffer::make_buffer("GET / HTTP/1.1\r\n\r\n"), "\r\n") == 14u);
+        ASRT_TEST_CHECK(Buffer::FindDelimiter(Buffer::make_buffer("no delimiter"), "\r\n") == Buffer::kDynamicExtent);
+        ASRT_TEST_CHECK(Buffer::FindDelimiter(Buffer::make_buffer("ends with \r"), "\r\n") == Buffer::kDynamicExtent);
+        ASRT_TEST_CHECK(Buffer::FindDelimiter(Buffer::ConstBufferView{}, "\n") == Buffer::kDynamicExtent);
+
+        /* compare against std::string_view::find() for delimiters placed across vector block boundaries */
+        std::mt19937 rng{42u};
+        for(std::string_view const delimiter : {"\n", "\r\n", "\r\n\r\n", "--boundary--"}){
+            for(std::size_t size{0u}; size < 200u; ++size){
+                std::string haystack(size, 'x');
+                for(char& c : haystack) c = static_cast<char>('a' + rng() % 4u);
+                if(size >= delimiter.size() && (rng() % 4u) != 0u){
+                    haystack.replace(rng() % (size - delimiter.size() + 1u), delimiter.size(), delimiter);
+                }
+
+                std::size_t const expected{std::string_view{haystack}.find(delimiter)};
+                std::size_t const found{Buffer::FindDelimiter(Buffer::make_buffer(haystack), delimiter)};
+                ASRT_TEST_CHECK(found == (expected == std::string_view::npos ? Buffer::kDynamicExtent : expected));
+            }
+        }
+    }
+}
+
+int main()
+{
+    TestPrepareCommitConsume();
+    TestCompaction();
+    TestMaxSize();
+    TestFindDelimiter();
+
+    return asrt::test::Result();
+}
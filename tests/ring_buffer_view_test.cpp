@@ -0,0 +1,117 @@
+/**
+ * @brief RingBufferView wraparound and single producer single consumer streaming
+ */
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+#include "asrt/ring_buffer_view.hpp"
+#include "test_util.hpp"
+
+namespace{
+
+    std::string_view AsString(Buffer::ConstBufferView view)
+    {
+        return {reinterpret_cast<char const*>(view.data()), view.size()};
+    }
+
+    void TestCreate()
+    {
+        auto ring{asrt::RingBufferView::Create(1u)};
+        ASRT_TEST_CHECK(ring.has_value());
+        ASRT_TEST_CHECK(ring->Capacity() >= 1u && std::has_single_bit(ring->Capacity()));
+        ASRT_TEST_CHECK(ring->Empty());
+        ASRT_TEST_CHECK(ring->Prepare().size() == ring->Capacity());
+
+        ASRT_TEST_CHECK(!asrt::RingBufferView::Create(asrt::RingBufferView::kMaxCapacity + 1u).has_value());
+    }
+
+    void TestWraparound()
+    {
+        auto ring{asrt::RingBufferView::Create(1u)};
+        ASRT_TEST_CHECK(ring.has_value());
+        std::size_t const capacity{ring->Capacity()};
+
+        /* move both indices to 4 bytes before the end of the ring */
+        ring->Commit(capacity - 4u);
+        ring->Consume(capacity - 4u);
+
+        constexpr std::string_view kFrame{"split across the end"};
+        Buffer::MutableBufferView const space{ring->Prepare()};
+        ASRT_TEST_CHECK(space.size() == capacity);
+        std::memcpy(space.data(), kFrame.data(), kFrame.size());
+        ring->Commit(kFrame.size());
+
+        /* the frame reads back contiguously and its tail landed at the start of the storage */
+        ASRT_TEST_CHECK(AsString(ring->Data()) == kFrame);
+        auto const* const front{static_cast<std::uint8_t const*>(ring->Data().data())};
+        ASRT_TEST_CHECK(std::memcmp(front + 4 - capacity, kFrame.data() + 4, kFrame.size() - 4u) == 0);
+
+        ring->Consume(kFrame.size());
+        ASRT_TEST_CHECK(ring->Empty());
+        ASRT_TEST_CHECK(ring->Prepare().size() == capacity);
+    }
+
+    void TestFull()
+    {
+        auto ring{asrt::RingBufferView::Create(1u)};
+        ASRT_TEST_CHECK(ring.has_value());
+        ring->Commit(ring->Capacity());
+        ASRT_TEST_CHECK(ring->Prepare().size() == 0u);
+        ASRT_TEST_CHECK(ring->Data().size() == ring->Capacity());
+        ring->Consume(1u);
+        ASRT_TEST_CHECK(ring->Prepare().size() == 1u);
+    }
+
+    void TestStreaming()
+    {
+        auto ring{asrt::RingBufferView::Create(1u)};
+        ASRT_TEST_CHECK(ring.has_value());
+
+        /* odd chunk sizes so that the indices wrap at every possible offset */
+        constexpr std::uint32_t kTotal{1u << 22u};
+        std::thread producer{[&ring](){
+            std::uint32_t written{0u};
+            while(written < kTotal){
+                Buffer::MutableBufferView const space{ring->Prepare()};
+                auto* const bytes{static_cast<std::uint8_t*>(space.data())};
+                std::size_t const n{std::min<std::size_t>({space.size(), 997u, kTotal - written})};
+                if(n == 0u) std::this_thread::yield(); /* ring full */
+                for(std::size_t i{0u}; i < n; ++i){
+                    bytes[i] = static_cast<std::uint8_t>((written + i) % 251u);
+                }
+                ring->Commit(n);
+                written += static_cast<std::uint32_t>(n);
+            }
+        }};
+
+        std::uint32_t read{0u};
+        bool intact{true};
+        while(read < kTotal){
+            Buffer::ConstBufferView const data{ring->Data()};
+            auto const* const bytes{static_cast<std::uint8_t const*>(data.data())};
+            std::size_t const n{std::min<std::size_t>(data.size(), 1499u)};
+            if(n == 0u) std::this_thread::yield(); /* ring empty */
+            for(std::size_t i{0u}; i < n; ++i){
+                intact = intact && bytes[i] == static_cast<std::uint8_t>((read + i) % 251u);
+            }
+            ring->Consume(n);
+            read += static_cast<std::uint32_t>(n);
+        }
+        producer.join();
+
+        ASRT_TEST_CHECK(intact);
+        ASRT_TEST_CHECK(ring->Empty());
+    }
+}
+
+int main()
+{
+    TestCreate();
+    TestWraparound();
+    TestFull();
+    TestStreaming();
+
+    return asrt::test::Result();
+}
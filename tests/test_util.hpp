@@ -0,0 +1,35 @@
+#ifndef C4391715_412B_40AA_BB9F_DD27D53B5B4A
+#define C4391715_412B_40AA_BB9F_DD27D53B5B4A
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace asrt::test{
+
+    inline int& FailureCount() noexcept
+    {
+        static int failures{0};
+        return failures;
+    }
+
+    inline void Check(bool condition, char const* expression, char const* file, int line) noexcept
+    {
+        if(!condition){
+            ++FailureCount();
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+        }
+    }
+
+    /**
+     * @brief Exit status of a test executable, non-zero if any check failed
+     */
+    inline int Result() noexcept
+    {
+        return (FailureCount() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+} // end ns asrt::test
+
+#define ASRT_TEST_CHECK(expr) ::asrt::test::Check(static_cast<bool>(expr), #expr, __FILE__, __LINE__)
+
+#endif /* C4391715_412B_40AA_BB9F_DD27D53B5B4A */
@@ -0,0 +1,78 @@
+/**
+ * @brief A SteadyTimer that rearms itself from its handler at 10 kHz must not allocate once warmed up
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "asrt/timer/steady_timer.hpp"
+#include "test_util.hpp"
+
+namespace{
+
+    std::atomic<bool> count_allocations{false};
+    std::atomic<std::size_t> allocations{0u};
+
+    constexpr int kWarmupCycles{100};
+    constexpr int kMeasuredCycles{10000};
+    constexpr auto kPeriod{std::chrono::microseconds{100}};
+
+    using Executor = Timer::ExecutorType;
+
+    struct RearmingHandler{
+        Timer::SteadyTimer* timer_;
+        Executor* executor_;
+        int* cycles_;
+
+        void operator()() const noexcept
+        {
+            ++*this->cycles_;
+            if(*this->cycles_ == kWarmupCycles){
+                count_allocations.store(true);
+            }else if(*this->cycles_ == kWarmupCycles + kMeasuredCycles){
+                count_allocations.store(false);
+                this->executor_->Stop();
+                return;
+            }
+
+            if(!this->timer_->WaitAsync(*this).has_value()){
+                std::fprintf(stderr, "rearm failed at cycle %d\n", *this->cycles_);
+                count_allocations.store(false);
+                this->executor_->Stop();
+            }
+        }
+    };
+}
+
+/* the replacements below pair malloc with free, gcc cannot tell once they are inlined */
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new(std::size_t size)
+{
+    if(count_allocations.load(std::memory_order_relaxed)){
+        allocations.fetch_add(1u, std::memory_order_relaxed);
+    }
+    if(void* memory{std::malloc(size ? size : 1u)}) return memory;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
+int main()
+{
+    Executor executor{Executor::ExecutorConfig::ENABLE_ALL_SERVICES, 1u};
+    Timer::SteadyTimer timer{executor, kPeriod};
+    int cycles{0};
+
+    ASRT_TEST_CHECK(timer.WaitAsync(RearmingHandler{&timer, &executor, &cycles}).has_value());
+    (void)executor.Run();
+
+    std::printf("%d cycles, %zu allocation(s) after warm-up\n", cycles, allocations.load());
+    ASRT_TEST_CHECK(cycles == kWarmupCycles + kMeasuredCycles);
+    ASRT_TEST_CHECK(allocations.load() == 0u);
+
+    return asrt::test::Result();
+}
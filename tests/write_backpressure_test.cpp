@@ -0,0 +1,240 @@
+/**
+ * @brief WriteCoalescer watermarks and overflow policies against a slow reader
+ */
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "asrt/unix/unix_domain.hpp"
+#include "asrt/executor/executor_work_guard.hpp"
+#include "asrt/socket/write_coalescer.hpp"
+#include "test_util.hpp"
+
+namespace{
+
+    using namespace std::chrono_literals;
+    using Coalescer = Socket::WriteCoalescer<Unix::StreamSocket>;
+
+    constexpr std::uint32_t kMessages{3000u};
+    constexpr std::size_t kMessageSize{1000u};
+    constexpr std::size_t kHighWatermark{64u * 1024u};
+    constexpr std::size_t kLowWatermark{16u * 1024u};
+
+    Socket::WriteCoalescerOptions Options(Socket::OverflowPolicy policy)
+    {
+        return {.flush_threshold_ = 4096u, .high_watermark_ = kHighWatermark,
+            .low_watermark_ = kLowWatermark, .overflow_policy_ = policy};
+    }
+
+    /* small socket buffers so that the unsent data backs up in the coalescer */
+    struct SocketPair
+    {
+        SocketPair()
+        {
+            ASRT_TEST_CHECK(::socketpair(AF_UNIX, SOCK_STREAM, 0, this->fds_) == 0);
+            int const size{16384};
+            ::setsockopt(this->fds_[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+            ::setsockopt(this->fds_[1], SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+        }
+        ~SocketPair() { ::close(this->fds_[1]); }
+
+        int fds_[2]{-1, -1};
+    };
+
+    /* a message carries its sequence number followed by a pattern derived from it */
+    void Fill(std::uint8_t* message, std::uint32_t sequence)
+    {
+        std::memcpy(message, &sequence, sizeof(sequence));
+        for(std::size_t i{sizeof(sequence)}; i < kMessageSize; ++i) message[i] = static_cast<std::uint8_t>(sequence + i);
+    }
+
+    /* stop once the completion of the last send ran, the coalescer must outlive it */
+    void StopOnceSent(Unix::Executor& executor, Coalescer& coalescer)
+    {
+        executor.Post([&executor, &coalescer](){
+            if(coalescer.UnsentBytes() == 0u) executor.Stop();
+            else StopOnceSent(executor, coalescer);
+        });
+    }
+
+    struct Received
+    {
+        std::size_t messages_{0u};
+        bool intact_{true};   /* every message whole and in increasing order */
+        bool contiguous_{true}; /* no message missing */
+    };
+
+    /* read slowly until the last message or the end of the stream */
+    Received Drain(int fd)
+    {
+        Received received;
+        std::vector<std::uint8_t> message(kMessageSize);
+        std::int64_t last{-1};
+        while(::recv(fd, message.data(), kMessageSize, MSG_WAITALL) == static_cast<::ssize_t>(kMessageSize)){
+            std::uint32_t sequence;
+            std::memcpy(&sequence, message.data(), sizeof(sequence));
+            for(std::size_t i{sizeof(sequence)}; i < kMessageSize; ++i){
+                received.intact_ = received.intact_ && message[i] == static_cast<std::uint8_t>(sequence + i);
+            }
+            received.intact_ = received.intact_ && sequence > last;
+            received.contiguous_ = received.contiguous_ && sequence == last + 1;
+            last = sequence;
+            ++received.messages_;
+            if(sequence + 1u == kMessages) break;
+            std::this_thread::sleep_for(20us);
+        }
+        return received;
+    }
+
+    void TestDropOldest(Unix::Executor& executor)
+    {
+        SocketPair pair;
+        Unix::StreamSocket socket{executor};
+        ASRT_TEST_CHECK(socket.AssignAcceptedHandle(Unix::Stream(), pair.fds_[0]).has_value());
+        ASRT_TEST_CHECK(socket.SetNonBlocking().has_value());
+        Coalescer coalescer{socket, executor, Options(Socket::OverflowPolicy::kDropOldest)};
+
+        std::atomic<int> writable{0};
+        coalescer.SetWritableHandler([&writable](){ ++writable; });
+
+        std::uint32_t sequence{0u};
+        std::size_t max_unsent{0u};
+        bool accepted{true};
+        std::function<void()> write_turn{[&](){
+            std::uint8_t message[kMessageSize];
+            for(int i{0}; i < 100 && sequence < kMessages; ++i){
+                Fill(message, sequence++);
+                accepted = coalescer.Write(Buffer::ConstBufferView{message, kMessageSize}).has_value() && accepted;
+                max_unsent = std::max(max_unsent, coalescer.UnsentBytes());
+            }
+            if(sequence < kMessages) executor.Post(std::function{write_turn});
+        }};
+
+        ExecutorNS::WorkGuard const guard{executor};
+        Received received;
+        std::thread receiver{[&](){
+            received = Drain(pair.fds_[1]);
+            StopOnceSent(executor, coalescer);
+        }};
+        executor.Post(std::function{write_turn});
+        static_cast<void>(executor.Run());
+        receiver.join();
+
+        Socket::WriteCoalescerStatistics const statistics{coalescer.GetStatistics()};
+        ASRT_TEST_CHECK(accepted);
+        ASRT_TEST_CHECK(received.intact_);
+        ASRT_TEST_CHECK(statistics.dropped_writes_ > 0u);
+        ASRT_TEST_CHECK(statistics.dropped_bytes_ == statistics.dropped_writes_ * kMessageSize);
+        ASRT_TEST_CHECK(received.messages_ + statistics.dropped_writes_ == kMessages);
+        ASRT_TEST_CHECK(max_unsent <= kHighWatermark);
+        ASRT_TEST_CHECK(statistics.high_watermark_hits_ > 0u);
+        ASRT_TEST_CHECK(writable > 0);
+    }
+
+    void TestDisconnect(Unix::Executor& executor)
+    {
+        SocketPair pair; /* never read */
+        Unix::StreamSocket socket{executor};
+        ASRT_TEST_CHECK(socket.AssignAcceptedHandle(Unix::Stream(), pair.fds_[0]).has_value());
+        ASRT_TEST_CHECK(socket.SetNonBlocking().has_value());
+        Coalescer coalescer{socket, executor, Options(Socket::OverflowPolicy::kDisconnect)};
+
+        asrt::ErrorCodeType reported{asrt::ErrorCodeType::no_error};
+        coalescer.SetErrorHandler([&](asrt::ErrorCodeType ec){
+            reported = ec;
+            executor.Stop();
+        });
+
+        asrt::ErrorCodeType rejected{asrt::ErrorCodeType::no_error};
+        std::size_t accepted{0u};
+        executor.Post([&](){
+            std::uint8_t message[kMessageSize];
+            for(std::uint32_t sequence{0u}; sequence < kMessages; ++sequence){
+                Fill(message, sequence);
+                auto const result{coalescer.Write(Buffer::ConstBufferView{message, kMessageSize})};
+                if(not result.has_value()){
+                    rejected = result.error();
+                    break;
+                }
+                ++accepted;
+            }
+        });
+        ExecutorNS::WorkGuard const guard{executor};
+        executor.Restart();
+        static_cast<void>(executor.Run());
+
+        ASRT_TEST_CHECK(rejected == asrt::ErrorCodeType::no_buffer_space);
+        ASRT_TEST_CHECK(reported == asrt::ErrorCodeType::no_buffer_space);
+        ASRT_TEST_CHECK(accepted * kMessageSize <= kHighWatermark);
+        ASRT_TEST_CHECK(not coalescer.IsWritable());
+        ASRT_TEST_CHECK(coalescer.PendingBytes() == 0u);
+    }
+
+    void TestBlock(Unix::Executor& executor)
+    {
+        SocketPair pair;
+        Unix::StreamSocket socket{executor};
+        ASRT_TEST_CHECK(socket.AssignAcceptedHandle(Unix::Stream(), pair.fds_[0]).has_value());
+        ASRT_TEST_CHECK(socket.SetNonBlocking().has_value());
+        Coalescer coalescer{socket, executor, Options(Socket::OverflowPolicy::kBlock)};
+
+        std::atomic<int> writable{0};
+        coalescer.SetWritableHandler([&writable](){ ++writable; });
+
+        /* blocking is refused in executor context, where the unsent data would never drain */
+        asrt::ErrorCodeType refused{asrt::ErrorCodeType::no_error};
+        executor.Post([&](){
+            std::vector<std::uint8_t> const oversized(kHighWatermark + 1u);
+            auto const result{coalescer.Write(Buffer::ConstBufferView{oversized.data(), oversized.size()})};
+            if(not result.has_value()) refused = result.error();
+        });
+
+        std::atomic<std::size_t> max_unsent{0u};
+        bool accepted{true};
+        std::thread producer{[&](){
+            std::uint8_t message[kMessageSize];
+            for(std::uint32_t sequence{0u}; sequence < kMessages; ++sequence){
+                Fill(message, sequence);
+                accepted = coalescer.Write(Buffer::ConstBufferView{message, kMessageSize}).has_value() && accepted;
+                max_unsent = std::max(max_unsent.load(), coalescer.UnsentBytes());
+            }
+        }};
+
+        ExecutorNS::WorkGuard const guard{executor};
+        Received received;
+        std::thread receiver{[&](){
+            received = Drain(pair.fds_[1]);
+            StopOnceSent(executor, coalescer);
+        }};
+        executor.Restart();
+        static_cast<void>(executor.Run());
+        producer.join();
+        receiver.join();
+
+        ASRT_TEST_CHECK(refused == asrt::ErrorCodeType::would_block);
+        ASRT_TEST_CHECK(accepted);
+        ASRT_TEST_CHECK(received.intact_ && received.contiguous_);
+        ASRT_TEST_CHECK(received.messages_ == kMessages);
+        ASRT_TEST_CHECK(max_unsent <= kHighWatermark);
+        ASRT_TEST_CHECK(coalescer.GetStatistics().dropped_writes_ == 0u);
+        ASRT_TEST_CHECK(writable > 0);
+    }
+}
+
+int main()
+{
+    std::signal(SIGPIPE, SIG_IGN);
+    Unix::Executor executor;
+    TestDropOldest(executor);
+    TestBlock(executor);
+    TestDisconnect(executor); /* last, leaves a send pending on the unread socket */
+
+    return asrt::test::Result();
+}
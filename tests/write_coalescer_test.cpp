@@ -0,0 +1,147 @@
+/**
+ * @brief WriteCoalescer merges the writes of an executor turn into few sends, in order
+ */
+#include <csignal>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "asrt/unix/unix_domain.hpp"
+#include "asrt/executor/executor_work_guard.hpp"
+#include "asrt/socket/write_coalescer.hpp"
+#include "test_util.hpp"
+
+namespace{
+
+    using Coalescer = Socket::WriteCoalescer<Unix::StreamSocket>;
+
+    constexpr std::size_t kTurns{100u};
+    constexpr std::size_t kWritesPerTurn{200u};
+    constexpr std::size_t kWriteSize{37u};
+    constexpr std::size_t kSharedSize{4096u}; /* above the copy threshold */
+
+    /* a connected pair, the coalescer sends on the non-blocking end and the test reads the blocking one */
+    struct SocketPair
+    {
+        SocketPair()
+        {
+            ASRT_TEST_CHECK(::socketpair(AF_UNIX, SOCK_STREAM, 0, this->fds_) == 0);
+        }
+        ~SocketPair() { if(this->fds_[1] >= 0) ::close(this->fds_[1]); }
+
+        int fds_[2]{-1, -1};
+    };
+
+    std::uint8_t Pattern(std::size_t offset) { return static_cast<std::uint8_t>(offset % 251u); }
+
+    bool ReceiveAll(int fd, std::size_t total)
+    {
+        std::vector<std::uint8_t> data(total);
+        std::size_t received{0u};
+        while(received < total){
+            ::ssize_t const n{::recv(fd, data.data() + received, total - received, 0)};
+            if(n <= 0) return false;
+            received += static_cast<std::size_t>(n);
+        }
+        for(std::size_t i{0u}; i < total; ++i){
+            if(data[i] != Pattern(i)) return false;
+        }
+        return true;
+    }
+
+    void TestCoalescing(Unix::Executor& executor)
+    {
+        Buffer::BufferPool pool; /* outlives the pooled buffers held by the coalescer */
+        SocketPair pair;
+        Unix::StreamSocket socket{executor};
+        ASRT_TEST_CHECK(socket.AssignAcceptedHandle(Unix::Stream(), pair.fds_[0]).has_value());
+        ASRT_TEST_CHECK(socket.SetNonBlocking().has_value());
+        Coalescer coalescer{socket, executor, {.flush_threshold_ = 16384u}};
+
+        /* every turn ends with a header and a pooled body queued as a single write */
+        std::size_t const turn_bytes{kWritesPerTurn * kWriteSize + kWriteSize + kSharedSize};
+        std::size_t const total{kTurns * turn_bytes};
+        bool intact{false};
+        ExecutorNS::WorkGuard const guard{executor}; /* keeps Run() going until stopped below */
+        std::function<void()> stop_once_sent{[&](){
+            /* the completion of the last send may still be queued after the receiver got all the data */
+            if(coalescer.UnsentBytes() == 0u) executor.Stop();
+            else executor.Post(std::function{stop_once_sent});
+        }};
+        std::thread receiver{[&](){
+            intact = ReceiveAll(pair.fds_[1], total);
+            executor.Post(std::function{stop_once_sent});
+        }};
+
+        std::size_t offset{0u};
+        std::size_t turn{0u};
+        bool accepted{true};
+        std::function<void()> write_turn{[&](){
+            std::uint8_t data[kWriteSize];
+            for(std::size_t i{0u}; i <= kWritesPerTurn; ++i){
+                for(std::uint8_t& byte : data) byte = Pattern(offset++);
+                if(i < kWritesPerTurn){
+                    accepted = coalescer.Write(Buffer::ConstBufferView{data, kWriteSize}).has_value() && accepted;
+                    continue;
+                }
+                Buffer::PooledBuffer body{pool.Allocate(kSharedSize)};
+                auto* const bytes{body.data()};
+                for(std::size_t j{0u}; j < kSharedSize; ++j) bytes[j] = Pattern(offset++);
+                accepted = coalescer.Write(Buffer::ConstBufferView{data, kWriteSize}, std::move(body)).has_value() && accepted;
+            }
+            if(++turn < kTurns) executor.Post(std::function{write_turn});
+        }};
+        executor.Post(std::function{write_turn});
+        executor.Run();
+        receiver.join();
+
+        Socket::WriteCoalescerStatistics const statistics{coalescer.GetStatistics()};
+        ASRT_TEST_CHECK(accepted);
+        ASRT_TEST_CHECK(intact);
+        ASRT_TEST_CHECK(statistics.writes_ == kTurns * (kWritesPerTurn + 1u));
+        ASRT_TEST_CHECK(statistics.shared_writes_ == kTurns);
+        ASRT_TEST_CHECK(statistics.bytes_ == total);
+        /* a turn fits below the flush threshold, so it leaves with about one send */
+        ASRT_TEST_CHECK(statistics.flushes_ <= 2u * kTurns);
+        ASRT_TEST_CHECK(coalescer.UnsentBytes() == 0u);
+    }
+
+    void TestSendFailure(Unix::Executor& executor)
+    {
+        SocketPair pair;
+        Unix::StreamSocket socket{executor};
+        ASRT_TEST_CHECK(socket.AssignAcceptedHandle(Unix::Stream(), pair.fds_[0]).has_value());
+        ASRT_TEST_CHECK(socket.SetNonBlocking().has_value());
+        Coalescer coalescer{socket, executor};
+
+        asrt::ErrorCodeType reported{asrt::ErrorCodeType::no_error};
+        coalescer.SetErrorHandler([&](asrt::ErrorCodeType ec){
+            reported = ec;
+            executor.Stop();
+        });
+
+        ::close(std::exchange(pair.fds_[1], -1)); /* the peer is gone */
+        std::uint8_t const data[16]{};
+        ASRT_TEST_CHECK(coalescer.Write(Buffer::ConstBufferView{data, sizeof(data)}).has_value());
+        executor.Restart();
+        executor.Run();
+
+        ASRT_TEST_CHECK(reported != asrt::ErrorCodeType::no_error);
+        ASRT_TEST_CHECK(not coalescer.Write(Buffer::ConstBufferView{data, sizeof(data)}).has_value());
+        ASRT_TEST_CHECK(not coalescer.IsWritable());
+    }
+}
+
+int main()
+{
+    std::signal(SIGPIPE, SIG_IGN);
+    Unix::Executor executor;
+    TestCoalescing(executor);
+    TestSendFailure(executor);
+
+    return asrt::test::Result();
+}